@@ -65,6 +65,10 @@ SOLUTIONS IMPLEMENTED (FOR REVISION)
    - TC: O(n)
    - SC: O(1)
 
+5) Zero-Copy Binary Input (mmap)
+   - TC: O(n)
+   - SC: O(1)
+
 --------------------------------------------------------------------
 INTERVIEW TAKEAWAY
 --------------------------------------------------------------------
@@ -80,6 +84,8 @@ This pattern appears in:
 */
 
 #include <bits/stdc++.h>
+#include "../common/binary_grid.h"
+#include "../common/fast_input.h"
 using namespace std;
 
 /* ---------------------------------------------------------------
@@ -212,25 +218,70 @@ public:
     }
 };
 
-int main() {
-    int n;
-    cin >> n;
+/* ---------------------------------------------------------------
+   APPROACH 5: Zero-Copy Binary Input (mmap)
+   Same as APPROACH 4, reading the n x 3 points in place from a
+   GridView over a mapped binary file (common/binary_grid.h).
+---------------------------------------------------------------- */
+class NinjaTrainingMapped {
+public:
+    int ninjaTraining(const GridView& points) {
+        int n = points.rows();
+        int prev[4], curr[4];
+
+        const int* p = points.row(0);
+        prev[0] = max(p[1], p[2]);
+        prev[1] = max(p[0], p[2]);
+        prev[2] = max(p[0], p[1]);
+        prev[3] = max({p[0], p[1], p[2]});
+
+        for(int day = 1; day < n; day++) {
+            p = points.row(day);
+            for(int last = 0; last < 4; last++) {
+                curr[last] = 0;
+                for(int task = 0; task < 3; task++) {
+                    if(task != last) {
+                        curr[last] = max(curr[last], p[task] + prev[task]);
+                    }
+                }
+            }
+            copy(curr, curr + 4, prev);
+        }
+
+        return prev[3];
+    }
+};
 
-    vector<vector<int>> points(n, vector<int>(3));
-    for(int i = 0; i < n; i++) {
-        for(int j = 0; j < 3; j++) {
-            cin >> points[i][j];
+int main(int argc, char** argv) {
+    // binary grid file (common/binary_grid.h): mmap, no parsing
+    if(argc > 1) {
+        MappedGrid file;
+        string error;
+        if(!file.open(argv[1], &error) || !checkRectangle(file.view(), 3, false, &error)) {
+            cerr << error << endl;
+            return 1;
         }
+
+        NinjaTrainingMapped sol;
+        cout << sol.ninjaTraining(file.view()) << endl;
+        return 0;
     }
 
+    // bulk parse straight into one flat n x 3 buffer
+    FastInput in;
+    int n = in.nextInt();
+
+    vector<int> points(3 * (size_t)n);
+    in.readInts(points.data(), points.size());
+
     // vector<vector<int>> points = {
     //     {2, 1, 3},
     //     {3, 4, 6},
     //     {10, 1, 6}
     // };
 
-    NinjaTrainingSpaceOptimized sol;
-    cout << sol.ninjaTraining(points) << endl;
+    NinjaTrainingMapped sol;
+    cout << sol.ninjaTraining(GridView(points.data(), n, 3)) << endl;
 
     return 0;
 }
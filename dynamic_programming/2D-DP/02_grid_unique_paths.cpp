@@ -53,6 +53,7 @@ think GRID DP and build from top-left to bottom-right.
 */
 
 #include <bits/stdc++.h>
+#include "../common/fast_input.h"
 using namespace std;
 
 /* ---------------------------------------------------------------
@@ -154,8 +155,9 @@ public:
 };
 
 int main() {
-    int n, m;
-    cin >> n >> m;
+    FastInput in;
+    int n = in.nextInt();
+    int m = in.nextInt();
 
     GridUniquePathsSpaceOptimized sol;
     cout << sol.uniquePaths(n, m) << endl;
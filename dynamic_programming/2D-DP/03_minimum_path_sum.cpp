@@ -45,6 +45,11 @@ SOLUTIONS IMPLEMENTED
 2) Memoization (DP)     → O(n*m)
 3) Tabulation (DP)      → O(n*m)
 4) Space Optimization   → O(m)
+5) Streaming Rows       → O(m), rows read one at a time
+6) Binary Grid (mmap)   → O(m), zero-copy input
+7) Wavefront Tiles      → O(n*m / P), P threads, O(n + m)
+8) Prefix Scan (SIMD)   → O(n*m), row as min-plus scan, O(m)
+9) Tiled + Path Output  → O(n*m), tile boundaries only, returns moves
 
 --------------------------------------------------------------------
 INTERVIEW TAKEAWAY
@@ -56,6 +61,13 @@ If cost is involved:
 */
 
 #include <bits/stdc++.h>
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define MIN_PATH_X86 1
+#endif
+#include "../common/binary_grid.h"
+#include "../common/fast_input.h"
+#include "../common/row_stream.h"
 using namespace std;
 
 /* ---------------------------------------------------------------
@@ -188,19 +200,469 @@ public:
     }
 };
 
-int main() {
-    int n, m;
-    cin >> n >> m;
+/* ---------------------------------------------------------------
+   APPROACH 5: Streaming Rows (SPACE OPTIMIZED, NO GRID IN MEMORY)
+   Same recurrence as APPROACH 4, but rows come from a RowReader
+   (common/row_stream.h) one at a time, so only the current row and
+   one DP row are ever resident.
+   TC: O(n * m)
+   SC: O(m)
+---------------------------------------------------------------- */
+class MinPathSumStreaming {
+public:
+    int minPathSum(int m, const RowReader& nextRow) {
+        vector<int> row, dp(m, 0);
+        if (!nextRow(row)) return 0;
+
+        dp[0] = row[0];
+        for (int j = 1; j < m; j++)
+            dp[j] = row[j] + dp[j - 1];
 
-    vector<vector<int>> grid(n, vector<int>(m));
-    for (int i = 0; i < n; i++) {
-        for (int j = 0; j < m; j++) {
-            cin >> grid[i][j];
+        while (nextRow(row)) {
+            dp[0] += row[0];
+            for (int j = 1; j < m; j++)
+                dp[j] = row[j] + min(dp[j], dp[j - 1]);
         }
+
+        return dp[m - 1];
+    }
+};
+
+/* ---------------------------------------------------------------
+   APPROACH 6: Zero-Copy Binary Grid (mmap)
+   Same recurrence as APPROACH 4, reading rows in place from a
+   GridView over a mapped binary file (common/binary_grid.h).
+   TC: O(n * m)
+   SC: O(m)
+---------------------------------------------------------------- */
+class MinPathSumMapped {
+public:
+    int minPathSum(const GridView& grid) {
+        int n = grid.rows();
+        int m = grid.rowLength(0);
+
+        vector<int> dp(m);
+        const int* row = grid.row(0);
+
+        dp[0] = row[0];
+        for (int j = 1; j < m; j++)
+            dp[j] = row[j] + dp[j - 1];
+
+        for (int i = 1; i < n; i++) {
+            row = grid.row(i);
+            dp[0] += row[0];
+            for (int j = 1; j < m; j++)
+                dp[j] = row[j] + min(dp[j], dp[j - 1]);
+        }
+
+        return dp[m - 1];
     }
+};
+
+/* ---------------------------------------------------------------
+   APPROACH 7: Wavefront-Parallel Tiles (MULTI-CORE)
+   Cell (i, j) needs (i-1, j) and (i, j-1), so no row can be split
+   across threads, but every anti-diagonal is independent. Lifted
+   to cache-sized tiles:
+
+     - tile (I, J) is ready once (I-1, J) and (I, J-1) are done,
+       tracked by one atomic dependency counter per tile
+     - a finished tile decrements its lower and right neighbours and
+       pushes whichever hits zero onto its own worker's deque
+     - workers pop their own deque LIFO (the tile just unlocked is
+       still warm) and steal FIFO from the others when it is empty
+
+   Tiles only exchange boundaries, kept as two flat arrays:
+     bottom[j] = last DP value computed in column j
+     right[i]  = last DP value computed in row i
+   Each slice has one reader (the next tile down / right), which runs
+   after its writer, so both are overwritten in place and the tile's
+   slice of `bottom` doubles as its DP row.
+   TC: O(n * m / P) on P threads once the wavefront is wide
+   SC: O(n + m) + one counter per tile
+---------------------------------------------------------------- */
+class TileScheduler {
+private:
+    struct alignas(64) WorkQueue {
+        mutex mtx;
+        deque<pair<int, int>> tiles;
+    };
+
+    int threads;
+
+public:
+    explicit TileScheduler(int threads) : threads(max(1, threads)) {}
+
+    // Runs task(I, J) once per tile of a tileRows x tileCols grid, each
+    // after its upper and left neighbours have finished.
+    void run(int tileRows, int tileCols, const function<void(int, int)>& task) {
+        long long total = (long long)tileRows * tileCols;
+        if (total == 0) return;
+
+        unique_ptr<atomic<int>[]> deps(new atomic<int>[total]);
+        for (int I = 0; I < tileRows; I++)
+            for (int J = 0; J < tileCols; J++)
+                deps[(long long)I * tileCols + J] = (I > 0) + (J > 0);
+
+        vector<WorkQueue> queues(threads);
+        atomic<long long> remaining(total);
+        queues[0].tiles.push_back({0, 0});
+
+        auto release = [&](int me, int I, int J) {
+            if (--deps[(long long)I * tileCols + J] == 0) {
+                lock_guard<mutex> lock(queues[me].mtx);
+                queues[me].tiles.push_back({I, J});
+            }
+        };
+
+        auto take = [&](int me, pair<int, int>& tile) {
+            for (int k = 0; k < threads; k++) {
+                WorkQueue& q = queues[(me + k) % threads];
+                lock_guard<mutex> lock(q.mtx);
+                if (q.tiles.empty()) continue;
+
+                if (k == 0) {
+                    tile = q.tiles.back();
+                    q.tiles.pop_back();
+                } else {
+                    tile = q.tiles.front();
+                    q.tiles.pop_front();
+                }
+                return true;
+            }
+            return false;
+        };
+
+        auto worker = [&](int me) {
+            pair<int, int> tile;
+            while (remaining.load() > 0) {
+                if (!take(me, tile)) {
+                    this_thread::yield();
+                    continue;
+                }
+
+                int I = tile.first, J = tile.second;
+                task(I, J);
+
+                // pushed down first, so the LIFO pop takes the right one
+                if (I + 1 < tileRows) release(me, I + 1, J);
+                if (J + 1 < tileCols) release(me, I, J + 1);
+                remaining--;
+            }
+        };
+
+        vector<thread> helpers;
+        for (int id = 1; id < threads; id++)
+            helpers.emplace_back(worker, id);
+        worker(0);
+        for (auto& h : helpers) h.join();
+    }
+};
+
+class MinPathSumWavefront {
+private:
+    TileScheduler scheduler;
+    int tileRows, tileCols;
+
+public:
+    explicit MinPathSumWavefront(int threads = max(1u, thread::hardware_concurrency()),
+                                 int tileRows = 256, int tileCols = 2048)
+        : scheduler(threads), tileRows(max(1, tileRows)), tileCols(max(1, tileCols)) {}
+
+    int minPathSum(const GridView& grid) {
+        int n = grid.rows();
+        int m = grid.rowLength(0);
+
+        // INT_MAX = no path from that side. The virtual cell left of
+        // (0, 0) is 0, so the start needs no special case and every
+        // other cell has at least one finite neighbour.
+        vector<int> bottom(m, INT_MAX);
+        vector<int> right(n, INT_MAX);
+        right[0] = 0;
+
+        int TR = (n + tileRows - 1) / tileRows;
+        int TC = (m + tileCols - 1) / tileCols;
+
+        scheduler.run(TR, TC, [&](int I, int J) {
+            int r0 = I * tileRows, r1 = min(n, r0 + tileRows);
+            int c0 = J * tileCols, c1 = min(m, c0 + tileCols);
+            int* dp = bottom.data();
+
+            for (int i = r0; i < r1; i++) {
+                const int* row = grid.row(i);
+                int left = right[i];
+                for (int j = c0; j < c1; j++)
+                    left = dp[j] = row[j] + min(dp[j], left);
+                right[i] = left;
+            }
+        });
+
+        return bottom[m - 1];
+    }
+};
+
+/* ---------------------------------------------------------------
+   APPROACH 8: Min-Plus Prefix Scan Row Kernel (SIMD)
+   In APPROACH 4, curr[j] waits on curr[j-1]: one serial add + min
+   per cell. Unrolling that chain, with P[j] = grid[i][0] + ... +
+   grid[i][j] and P[-1] = 0:
+
+       curr[j] = min over k <= j of ( prev[k] + grid[i][k..j] )
+               = P[j] + min over k <= j of ( prev[k] - P[k-1] )
+
+   That is two prefix scans, a plus-scan (P) and a min-scan, and both
+   are associative, so a vector of 8 lanes is done in log2(8) = 3
+   shift-and-combine steps.
+
+   P is rebased at every 8-lane block: it restarts at 0, and the
+   block's left neighbour curr[j0 - 1] seeds the min-scan (the k = j0
+   term with an empty prefix), so P never spans more than 8 cells.
+
+   That alone does not keep the 32-bit lanes exact: a few large cells
+   in one block can still push P (and prev - P) past INT_MAX while
+   every DP value fits. So each block is checked first: if every cell
+   is in [0, 2^28), the block sum is below 2^31 and the scan is exact;
+   otherwise that block runs the scalar chain instead.
+
+   The kernel is picked ONCE at runtime through CPUID. The scalar
+   fallback is the 1-lane case of the same rebasing, i.e. the plain
+   APPROACH 4 chain.
+   TC: O(n * m), ~3 vector steps per 8 cells
+   SC: O(m)
+---------------------------------------------------------------- */
+typedef void (*MinPlusRowKernel)(const int* row, int* dp, int m);
+
+// Columns [from, m), given left = curr[from - 1] (INT_MAX if none).
+static void minPlusRowTail(const int* row, int* dp, int m, int from, int left) {
+    for (int j = from; j < m; j++)
+        left = dp[j] = row[j] + min(dp[j], left);
+}
+
+static void minPlusRowScalar(const int* row, int* dp, int m) {
+    minPlusRowTail(row, dp, m, 0, INT_MAX);
+}
+
+#ifdef MIN_PATH_X86
+__attribute__((target("avx2")))
+static void minPlusRowAVX2(const int* row, int* dp, int m) {
+    const __m256i inf = _mm256_set1_epi32(INT_MAX);
+    const __m256i last = _mm256_set1_epi32(7);
+    const __m256i lane3 = _mm256_set1_epi32(3);
+    const __m256i high = _mm256_set1_epi32((int)0xF0000000);  // cell >= 2^28 or < 0
+
+    __m256i left = inf;                         // curr[j - 1], all lanes
+
+    int j = 0;
+    for (; j + 8 <= m; j += 8) {
+        __m256i g = _mm256_loadu_si256((const __m256i*)(row + j));
+        __m256i d = _mm256_loadu_si256((const __m256i*)(dp + j));
+
+        // block sum may not fit 32 bits: plain chain for these 8 cells
+        if (!_mm256_testz_si256(g, high)) {
+            minPlusRowTail(row, dp, j + 8, j, _mm256_cvtsi256_si32(left));
+            left = _mm256_set1_epi32(dp[j + 7]);
+            continue;
+        }
+
+        // inclusive plus-scan of this block only: within each 128-bit
+        // half, then across
+        __m256i p = _mm256_add_epi32(g, _mm256_slli_si256(g, 4));
+        p = _mm256_add_epi32(p, _mm256_slli_si256(p, 8));
+        p = _mm256_add_epi32(p, _mm256_blend_epi32(_mm256_setzero_si256(),
+                                _mm256_permutevar8x32_epi32(p, lane3), 0xF0));
+
+        // q[k] = prev[k] - P[k-1], then inclusive min-scan with INT_MAX fill
+        __m256i q = _mm256_sub_epi32(d, _mm256_sub_epi32(p, g));
+        q = _mm256_min_epi32(q, _mm256_alignr_epi8(q, inf, 12));
+        q = _mm256_min_epi32(q, _mm256_alignr_epi8(q, inf, 8));
+        q = _mm256_min_epi32(q, _mm256_blend_epi32(inf,
+                                _mm256_permutevar8x32_epi32(q, lane3), 0xF0));
+        q = _mm256_min_epi32(q, left);
+
+        __m256i curr = _mm256_add_epi32(p, q);
+        _mm256_storeu_si256((__m256i*)(dp + j), curr);
+        left = _mm256_permutevar8x32_epi32(curr, last);
+    }
+
+    minPlusRowTail(row, dp, m, j, _mm256_cvtsi256_si32(left));
+}
+#endif
+
+static MinPlusRowKernel pickMinPlusRowKernel() {
+#ifdef MIN_PATH_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) return minPlusRowAVX2;
+#endif
+    return minPlusRowScalar;
+}
+
+static MinPlusRowKernel minPlusRowKernel() {
+    static const MinPlusRowKernel kernel = pickMinPlusRowKernel();
+    return kernel;
+}
+
+class MinPathSumPrefixScan {
+public:
+    int minPathSum(vector<vector<int>>& grid) {
+        int n = grid.size();
+        int m = grid[0].size();
+        MinPlusRowKernel kernel = minPlusRowKernel();
+
+        vector<int> dp(m);
+        dp[0] = grid[0][0];
+        for (int j = 1; j < m; j++)
+            dp[j] = grid[0][j] + dp[j - 1];
+
+        // dp holds prev on entry, curr on exit: each lane reads its own
+        // dp[k] before the store, so the update is in place
+        for (int i = 1; i < n; i++)
+            kernel(grid[i].data(), dp.data(), m);
+
+        return dp[m - 1];
+    }
+};
+
+/* ---------------------------------------------------------------
+   APPROACH 9: Cache-Tiled With Path Output
+   APPROACH 3 keeps all n x m DP values (one heap block per row) even
+   though recovering the path only ever needs a few of them at once.
+   Here the grid is cut into tileRows x tileCols tiles, and the DP
+   keeps just what is needed to rebuild any one tile later:
+
+     tops[I]  = DP row just above tile row I    (m values)
+     lefts[J] = DP column just left of tile column J  (n values)
+
+   1. Forward pass, tile after tile (row-major): the same in-place
+      boundary update as APPROACH 7, saving each tile's top and left
+      input before it runs.
+   2. Backtrack from (n-1, m-1): rebuild the current tile from its
+      saved boundaries, walk back inside it (predecessor = the smaller
+      of top / left), and rebuild the next tile once the walk leaves.
+      The path crosses at most TR + TC - 1 of the TR x TC tiles.
+
+   Moves come out as a string of 'R' / 'D' from (0, 0).
+   TC: O(n * m) + O((n + m) * tile side) for the rebuilds
+   SC: O(n * m / tileRows + n * m / tileCols) boundaries + one tile
+---------------------------------------------------------------- */
+class MinPathSumTiledPath {
+private:
+    int tileRows, tileCols;
+
+    // DP of rows [r0, r1) x cols [c0, c1) into `tile` (row stride
+    // c1 - c0), given DP row r0 - 1 (`top`, by column) and DP column
+    // c0 - 1 (`left`, by row).
+    static void fillTile(const GridView& grid, int r0, int r1, int c0, int c1,
+                         const int* top, const int* left, int* tile) {
+        int w = c1 - c0;
+        for (int i = r0; i < r1; i++) {
+            const int* row = grid.row(i);
+            const int* above = (i == r0) ? top + c0 : tile + (size_t)(i - r0 - 1) * w;
+            int* out = tile + (size_t)(i - r0) * w;
+
+            int prev = left[i];
+            for (int j = 0; j < w; j++)
+                prev = out[j] = row[c0 + j] + min(above[j], prev);
+        }
+    }
+
+public:
+    explicit MinPathSumTiledPath(int tileRows = 512, int tileCols = 512)
+        : tileRows(max(1, tileRows)), tileCols(max(1, tileCols)) {}
+
+    // Returns the minimum cost and fills `moves` with the path.
+    int minPathSum(const GridView& grid, string& moves) {
+        int n = grid.rows();
+        int m = grid.rowLength(0);
+        int TR = (n + tileRows - 1) / tileRows;
+        int TC = (m + tileCols - 1) / tileCols;
+
+        // same sentinels as APPROACH 7: INT_MAX outside, 0 left of (0, 0)
+        vector<int> bottom(m, INT_MAX), right(n, INT_MAX);
+        right[0] = 0;
+
+        vector<int> tops((size_t)TR * m), lefts((size_t)TC * n);
+
+        for (int I = 0; I < TR; I++) {
+            int r0 = I * tileRows, r1 = min(n, r0 + tileRows);
+            copy(bottom.begin(), bottom.end(), tops.begin() + (size_t)I * m);
+
+            for (int J = 0; J < TC; J++) {
+                int c0 = J * tileCols, c1 = min(m, c0 + tileCols);
+                copy(right.begin() + r0, right.begin() + r1,
+                     lefts.begin() + (size_t)J * n + r0);
+
+                for (int i = r0; i < r1; i++) {
+                    const int* row = grid.row(i);
+                    int prev = right[i];
+                    for (int j = c0; j < c1; j++)
+                        prev = bottom[j] = row[j] + min(bottom[j], prev);
+                    right[i] = prev;
+                }
+            }
+        }
+        int best = bottom[m - 1];
+
+        // backtrack, rebuilding one tile at a time
+        vector<int> tile((size_t)tileRows * tileCols);
+        moves.clear();
+
+        int i = n - 1, j = m - 1;
+        int curI = -1, curJ = -1;
+        while (i > 0 || j > 0) {
+            int I = i / tileRows, J = j / tileCols;
+            int r0 = I * tileRows, c0 = J * tileCols;
+            int w = min(m, c0 + tileCols) - c0;
+            const int* top = tops.data() + (size_t)I * m;
+            const int* left = lefts.data() + (size_t)J * n;
+
+            if (I != curI || J != curJ) {
+                fillTile(grid, r0, min(n, r0 + tileRows), c0, c0 + w,
+                         top, left, tile.data());
+                curI = I;
+                curJ = J;
+            }
+
+            int up = (i > r0) ? tile[(size_t)(i - r0 - 1) * w + (j - c0)] : top[j];
+            int lt = (j > c0) ? tile[(size_t)(i - r0) * w + (j - c0 - 1)] : left[i];
+
+            if (up <= lt) {
+                moves.push_back('D');
+                i--;
+            } else {
+                moves.push_back('R');
+                j--;
+            }
+        }
+
+        reverse(moves.begin(), moves.end());
+        return best;
+    }
+};
+
+int main(int argc, char** argv) {
+    // binary grid file (common/binary_grid.h): mmap, no parsing
+    if (argc > 1) {
+        MappedGrid file;
+        string error;
+        if (!file.open(argv[1], &error) || !checkRectangle(file.view(), 0, false, &error)) {
+            cerr << error << endl;
+            return 1;
+        }
+
+        MinPathSumWavefront sol;
+        cout << sol.minPathSum(file.view()) << endl;
+        return 0;
+    }
+
+    FastInput in;
+    int n = in.nextInt();
+    int m = in.nextInt();
+
+    // parse on a background thread while the DP consumes rows
+    PrefetchedRows rows(in.rowReader(n, m));
 
-    MinPathSumSpaceOptimized sol;
-    cout << sol.minPathSum(grid) << endl;
+    MinPathSumStreaming sol;
+    cout << sol.minPathSum(m, rows.reader()) << endl;
 
     return 0;
 }
\ No newline at end of file
@@ -53,6 +53,8 @@ TIME & SPACE COMPLEXITY
 - Memoization:  TC = O(n^2),      SC = O(n^2)
 - Tabulation:   TC = O(n^2),      SC = O(n^2)
 - Space Opt:    TC = O(n^2),      SC = O(n)
+- Binary mmap:  TC = O(n^2),      SC = O(n), zero-copy input
+- Packed:       TC = O(n^2),      SC = O(n), or O(1) in place
 
 --------------------------------------------------------------------
 INTERVIEW TAKEAWAY
@@ -63,6 +65,8 @@ INTERVIEW TAKEAWAY
 */
 
 #include <bits/stdc++.h>
+#include "../common/binary_grid.h"
+#include "../common/fast_input.h"
 using namespace std;
 
 /* ---------------------------------------------------------------
@@ -186,22 +190,130 @@ public:
 };
 
 /* ---------------------------------------------------------------
-   DRIVER CODE
+   APPROACH 5: Zero-Copy Binary Triangle (mmap)
+   Same recurrence as APPROACH 4, reading rows in place from a
+   triangle GridView (row-offset table) over a mapped binary file
+   (common/binary_grid.h). One DP buffer, updated right to left so
+   prev[j - 1] is still the previous row's value when it is read.
 ---------------------------------------------------------------- */
-int main() {
+class TriangleMinPathMapped {
+public:
+    int minimumTotal(const GridView& triangle) {
+        int n = triangle.rows();
+        vector<int> dp(n);
+        dp[0] = triangle(0, 0);
+
+        for (int i = 1; i < n; i++) {
+            const int* row = triangle.row(i);
+            dp[i] = row[i] + dp[i - 1];
+            for (int j = i - 1; j >= 1; j--)
+                dp[j] = row[j] + min(dp[j - 1], dp[j]);
+            dp[0] = row[0] + dp[0];
+        }
+
+        return *min_element(dp.begin(), dp.end());
+    }
+};
+
+/* ---------------------------------------------------------------
+   APPROACH 6: Packed Triangle + Allocation-Free Bottom-Up
+   PackedTriangle keeps all n(n+1)/2 cells in ONE array, row i
+   starting at i*(i+1)/2, so there is no per-row heap block and rows
+   are adjacent in memory. The offset is computed, not looked up.
+
+   Solving bottom-up removes every edge case: cell (i, j) always has
+   both children (i+1, j) and (i+1, j+1), and the answer is the
+   single value left at the apex.
+
+       dp[j] = tri[i][j] + min(dp[j], dp[j + 1]),   j = 0 .. i
+
+   Walking j upwards reads dp[j + 1] before it is overwritten, so one
+   buffer is enough. minimumTotalInPlace goes further and folds each
+   row into the one above inside the triangle itself (destroys the
+   input, zero allocations).
+---------------------------------------------------------------- */
+class PackedTriangle {
+private:
     int n;
-    cin >> n;
+    vector<int> cells;
+
+public:
+    static size_t offset(int i) { return (size_t)i * (i + 1) / 2; }
+
+    explicit PackedTriangle(int n = 0) : n(n), cells(offset(n)) {}
+
+    explicit PackedTriangle(const vector<vector<int>>& triangle)
+        : PackedTriangle(triangle.size()) {
+        for (int i = 0; i < n; i++)
+            copy(triangle[i].begin(), triangle[i].begin() + i + 1, row(i));
+    }
 
-    vector<vector<int>> triangle(n);
-    for (int i = 0; i < n; i++) {
-        triangle[i].resize(i + 1);
-        for (int j = 0; j <= i; j++) {
-            cin >> triangle[i][j];
+    int rows() const { return n; }
+
+    int* data() { return cells.data(); }
+    size_t size() const { return cells.size(); }
+
+    int* row(int i) { return cells.data() + offset(i); }
+    const int* row(int i) const { return cells.data() + offset(i); }
+
+    int operator()(int i, int j) const { return row(i)[j]; }
+};
+
+class TriangleMinPathPacked {
+public:
+    int minimumTotal(const PackedTriangle& triangle) {
+        int n = triangle.rows();
+        const int* last = triangle.row(n - 1);
+        vector<int> dp(last, last + n);
+
+        for (int i = n - 2; i >= 0; i--) {
+            const int* row = triangle.row(i);
+            for (int j = 0; j <= i; j++)
+                dp[j] = row[j] + min(dp[j], dp[j + 1]);
         }
+
+        return dp[0];
     }
 
-    TriangleMinPathSpaceOptimized sol;
-    cout << sol.minimumTotal(triangle) << endl;
+    int minimumTotalInPlace(PackedTriangle& triangle) {
+        int n = triangle.rows();
+
+        for (int i = n - 2; i >= 0; i--) {
+            int* row = triangle.row(i);
+            const int* below = triangle.row(i + 1);
+            for (int j = 0; j <= i; j++)
+                row[j] += min(below[j], below[j + 1]);
+        }
+
+        return triangle(0, 0);
+    }
+};
+
+/* ---------------------------------------------------------------
+   DRIVER CODE
+---------------------------------------------------------------- */
+int main(int argc, char** argv) {
+    // binary grid file (common/binary_grid.h): mmap, no parsing
+    if (argc > 1) {
+        MappedGrid file;
+        string error;
+        if (!file.open(argv[1], &error) || !checkTriangle(file.view(), &error)) {
+            cerr << error << endl;
+            return 1;
+        }
+
+        TriangleMinPathMapped sol;
+        cout << sol.minimumTotal(file.view()) << endl;
+        return 0;
+    }
+
+    // bulk parse straight into the packed triangle
+    FastInput in;
+    PackedTriangle triangle(in.nextInt());
+    in.readInts(triangle.data(), triangle.size());
+
+    TriangleMinPathPacked sol;
+    cout << sol.minimumTotalInPlace(triangle) << endl;
 
     return 0;
 }
@@ -43,8 +43,15 @@ TIME & SPACE COMPLEXITY
 --------------------------------------------------------------------
 - Recursion:    TC = Exponential, SC = O(n)
 - Memoization:  TC = O(n^2),      SC = O(n^2)
+- Iterative:    TC = O(n^2),      SC = O(visited states), no recursion
 - Tabulation:   TC = O(n^2),      SC = O(n^2)
 - Space Opt:    TC = O(n^2),      SC = O(n)
+- Streaming:    TC = O(n^2),      SC = O(n), rows read one at a time
+- Binary mmap:  TC = O(n^2),      SC = O(n), zero-copy input
+- Vectorized:   TC = O(n^2),      SC = O(n), branch-free SIMD rows
+- Incremental:  TC = O(changed cells) per update, O(n) per query,
+                SC = O(n^2)
+- Top-K paths:  TC = O(n^2 + K n log(K n)), SC = O(n^2 + K n)
 
 --------------------------------------------------------------------
 INTERVIEW TAKEAWAY
@@ -55,6 +62,14 @@ the three possible parents in the row above.
 */
 
 #include <bits/stdc++.h>
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define FALLING_PATH_X86 1
+#endif
+#include "../common/binary_grid.h"
+#include "../common/fast_input.h"
+#include "../common/row_stream.h"
+#include "../common/top_down_evaluator.h"
 using namespace std;
 
 /* ---------------------------------------------------------------
@@ -124,6 +139,62 @@ public:
     }
 };
 
+/* ---------------------------------------------------------------
+   APPROACH 2b: Memoization Without Recursion (Explicit Stack)
+   Same recurrence as APPROACH 2, driven by TopDownEvaluator
+   (common/top_down_evaluator.h): no native recursion, and the memo
+   is a hash map holding only the states actually visited.
+---------------------------------------------------------------- */
+class MinFallingPathIterativeMemo {
+private:
+    struct Problem {
+        typedef uint64_t State;
+        typedef int Value;
+        typedef hash<uint64_t> Hash;
+
+        vector<vector<int>>& mat;
+        int n;
+
+        // column shifted by one so j = -1 and j = n still pack
+        State key(int i, int j) const { return (uint64_t)i * (n + 2) + (j + 1); }
+        int rowOf(State k) const { return k / (n + 2); }
+        int colOf(State k) const { return (int)(k % (n + 2)) - 1; }
+
+        bool isBase(const State& k, Value& out) {
+            int i = rowOf(k), j = colOf(k);
+            if(j < 0 || j >= n) { out = INT_MAX; return true; }
+            if(i == 0) { out = mat[0][j]; return true; }
+            return false;
+        }
+
+        void dependencies(const State& k, vector<State>& out) {
+            int i = rowOf(k), j = colOf(k);
+            out.push_back(key(i - 1, j));
+            out.push_back(key(i - 1, j - 1));
+            out.push_back(key(i - 1, j + 1));
+        }
+
+        Value combine(const State& k, const vector<Value>& vals) {
+            int best = min({vals[0], vals[1], vals[2]});
+            if(best == INT_MAX) return INT_MAX;
+            return mat[rowOf(k)][colOf(k)] + best;
+        }
+    };
+
+public:
+    int minFallingPathSum(vector<vector<int>>& mat) {
+        int n = mat.size();
+        Problem problem{mat, n};
+        TopDownEvaluator<Problem> eval(problem);
+
+        int ans = INT_MAX;
+        for(int j = 0; j < n; j++) {
+            ans = min(ans, eval.evaluate(problem.key(n - 1, j)));
+        }
+        return ans;
+    }
+};
+
 /* ---------------------------------------------------------------
    APPROACH 3: Tabulation (Bottom-Up DP)
 ---------------------------------------------------------------- */
@@ -175,21 +246,346 @@ public:
 };
 
 /* ---------------------------------------------------------------
-   DRIVER CODE
+   APPROACH 5: Streaming Rows (NO MATRIX IN MEMORY)
+   Same recurrence as APPROACH 4, fed by a RowReader
+   (common/row_stream.h). Only the incoming row and two DP rows are
+   resident; the DP rows are swapped, not copied.
+---------------------------------------------------------------- */
+class MinFallingPathStreaming {
+public:
+    int minFallingPathSum(int n, const RowReader& nextRow) {
+        vector<int> row, prev(n), curr(n);
+        if(!nextRow(row)) return 0;
+        prev = row;
+
+        while(nextRow(row)) {
+            for(int j = 0; j < n; j++) {
+                int best = prev[j];
+                if(j > 0) best = min(best, prev[j - 1]);
+                if(j < n - 1) best = min(best, prev[j + 1]);
+
+                curr[j] = row[j] + best;
+            }
+            prev.swap(curr);
+        }
+
+        return *min_element(prev.begin(), prev.end());
+    }
+};
+
+/* ---------------------------------------------------------------
+   APPROACH 6: Zero-Copy Binary Grid (mmap)
+   Same recurrence as APPROACH 4, reading rows in place from a
+   GridView over a mapped binary file (common/binary_grid.h).
+---------------------------------------------------------------- */
+class MinFallingPathMapped {
+public:
+    int minFallingPathSum(const GridView& mat) {
+        int n = mat.rows();
+        const int* first = mat.row(0);
+        vector<int> prev(first, first + n), curr(n);
+
+        for(int i = 1; i < n; i++) {
+            const int* row = mat.row(i);
+            for(int j = 0; j < n; j++) {
+                int best = prev[j];
+                if(j > 0) best = min(best, prev[j - 1]);
+                if(j < n - 1) best = min(best, prev[j + 1]);
+
+                curr[j] = row[j] + best;
+            }
+            prev.swap(curr);
+        }
+
+        return *min_element(prev.begin(), prev.end());
+    }
+};
+
+/* ---------------------------------------------------------------
+   APPROACH 7: Vectorized Row Kernel (SIMD)
+   APPROACH 4 spends most of its time on the two edge checks per
+   cell. Pad both DP rows with INT_MAX on each side instead:
+
+       prev = [ INF | p0 p1 ... p(n-1) | INF ]
+
+   and every column becomes the same branch-free expression
+
+       curr[j+1] = mat[i][j] + min(prev[j], prev[j+1], prev[j+2])
+
+   i.e. three unaligned loads shifted by one lane, two mins and one
+   add per 8 cells with AVX2. INF is never added (the middle parent
+   always exists), and the padding cells are never written, so the
+   rows are swapped rather than copied.
+
+   The kernel is picked ONCE at runtime through CPUID, with a scalar
+   fallback running the same padded expression.
 ---------------------------------------------------------------- */
-int main() {
+typedef void (*FallingRowKernel)(const int* row, const int* prev, int* curr, int n);
+
+// prev / curr point at the padded rows; columns [from, n).
+static void fallingRowTail(const int* row, const int* prev, int* curr, int n, int from) {
+    for(int j = from; j < n; j++)
+        curr[j + 1] = row[j] + min({prev[j], prev[j + 1], prev[j + 2]});
+}
+
+static void fallingRowScalar(const int* row, const int* prev, int* curr, int n) {
+    fallingRowTail(row, prev, curr, n, 0);
+}
+
+#ifdef FALLING_PATH_X86
+__attribute__((target("avx2")))
+static void fallingRowAVX2(const int* row, const int* prev, int* curr, int n) {
+    int j = 0;
+    for(; j + 8 <= n; j += 8) {
+        __m256i left  = _mm256_loadu_si256((const __m256i*)(prev + j));
+        __m256i mid   = _mm256_loadu_si256((const __m256i*)(prev + j + 1));
+        __m256i right = _mm256_loadu_si256((const __m256i*)(prev + j + 2));
+        __m256i g     = _mm256_loadu_si256((const __m256i*)(row + j));
+
+        __m256i best = _mm256_min_epi32(_mm256_min_epi32(left, mid), right);
+        _mm256_storeu_si256((__m256i*)(curr + j + 1), _mm256_add_epi32(g, best));
+    }
+    fallingRowTail(row, prev, curr, n, j);
+}
+#endif
+
+static FallingRowKernel pickFallingRowKernel() {
+#ifdef FALLING_PATH_X86
+    __builtin_cpu_init();
+    if(__builtin_cpu_supports("avx2")) return fallingRowAVX2;
+#endif
+    return fallingRowScalar;
+}
+
+static FallingRowKernel fallingRowKernel() {
+    static const FallingRowKernel kernel = pickFallingRowKernel();
+    return kernel;
+}
+
+class MinFallingPathVectorized {
+private:
+    template<class RowAt>
+    int solve(int n, RowAt rowAt) {
+        if(n <= 0) return 0;
+        FallingRowKernel kernel = fallingRowKernel();
+
+        vector<int> prev(n + 2, INT_MAX), curr(n + 2, INT_MAX);
+        const int* first = rowAt(0);
+        copy(first, first + n, prev.begin() + 1);
+
+        for(int i = 1; i < n; i++) {
+            kernel(rowAt(i), prev.data(), curr.data(), n);
+            prev.swap(curr);
+        }
+
+        return *min_element(prev.begin() + 1, prev.end() - 1);
+    }
+
+public:
+    int minFallingPathSum(vector<vector<int>>& mat) {
+        return solve(mat.size(), [&](int i) { return mat[i].data(); });
+    }
+
+    int minFallingPathSum(const GridView& mat) {
+        return solve(mat.rows(), [&](int i) { return mat.row(i); });
+    }
+};
+
+/* ---------------------------------------------------------------
+   APPROACH 8: Incremental Re-Solve Under Cell Updates
+   Keeps the full tabulation dp (APPROACH 3) alive next to its own
+   copy of the matrix. Changing mat[i][j] can only affect dp cells in
+   the cone below (i, j): row k sees at most columns j - (k-i) ..
+   j + (k-i). Most of that cone usually keeps its old value, so the
+   update carries a dirty column interval down the rows:
+
+     - recompute row k over [lo - 1, hi + 1] of the previous row's
+       interval (every cell that can see a changed parent)
+     - shrink it to [first changed, last changed] column
+     - stop as soon as a row changes nothing
+
+   Cells between two changed ones are recomputed even if they did not
+   change, which is harmless. Both dp rows are padded with INT_MAX, as
+   in APPROACH 7, so no edge checks.
+
+   Why not a segment tree of per-block min-plus transfer matrices: a
+   block of s rows has a transfer band 2s + 1 wide, so on an n x n
+   matrix the upper tree levels are dense n x n and merging two costs
+   O(n^3), more than the full O(n^2) re-solve it replaces.
+
+   TC: build O(n^2); update O(dp cells changed + rows touched);
+       query O(n) over the last row
+   SC: O(n^2)
+---------------------------------------------------------------- */
+class MinFallingPathDynamic {
+private:
     int n;
-    cin >> n;
+    vector<int> mat;                        // n x n
+    vector<int> dp;                         // n x (n + 2), INT_MAX pads
+
+    int* dpRow(int i) { return dp.data() + (size_t)i * (n + 2); }
+    const int* dpRow(int i) const { return dp.data() + (size_t)i * (n + 2); }
+
+    // Recomputes dp[i][j] for j in [lo, hi]; returns the changed span
+    // (lo > hi if nothing changed).
+    pair<int, int> recompute(int i, int lo, int hi) {
+        const int* row = mat.data() + (size_t)i * n;
+        const int* prev = (i > 0) ? dpRow(i - 1) : nullptr;
+        int* curr = dpRow(i);
+
+        int first = hi + 1, last = lo - 1;
+        for(int j = lo; j <= hi; j++) {
+            int v = prev ? row[j] + min({prev[j], prev[j + 1], prev[j + 2]}) : row[j];
+            if(v != curr[j + 1]) {
+                curr[j + 1] = v;
+                first = min(first, j);
+                last = j;
+            }
+        }
+        return {first, last};
+    }
+
+public:
+    explicit MinFallingPathDynamic(const vector<vector<int>>& m)
+        : n(m.size()), mat((size_t)n * n), dp((size_t)n * (n + 2), INT_MAX) {
+        for(int i = 0; i < n; i++) {
+            copy(m[i].begin(), m[i].end(), mat.begin() + (size_t)i * n);
+            // force every cell to count as changed on the first pass
+            fill(dpRow(i) + 1, dpRow(i) + n + 1, INT_MIN);
+            recompute(i, 0, n - 1);
+        }
+    }
+
+    void update(int i, int j, int value) {
+        mat[(size_t)i * n + j] = value;
+
+        pair<int, int> span = recompute(i, j, j);
+        for(int k = i + 1; k < n && span.first <= span.second; k++)
+            span = recompute(k, max(0, span.first - 1), min(n - 1, span.second + 1));
+    }
+
+    int minFallingPathSum() const {
+        const int* last = dpRow(n - 1);
+        return *min_element(last + 1, last + n + 1);
+    }
+};
+
+/* ---------------------------------------------------------------
+   APPROACH 9: Top-K Falling Paths (LAZY BEST-FIRST ENUMERATION)
+   Falling paths are the source-to-sink paths of a layered DAG (row
+   0 -> row n-1, edges to the three cells below). After one forward
+   tabulation f(i, j) (APPROACH 3) the cheapest way to finish any
+   partial path is known exactly, so paths can be listed in cost
+   order without re-solving:
+
+     - a search node is a suffix: a path from (i, j) down to the last
+       row, cost s = its cell sum
+     - its key s + f(i, j) - mat[i][j] is the cost of the best full
+       path that ends with this suffix
+     - pop the smallest key; a suffix that reached row 0 is the next
+       best path, otherwise extend it by each of its <= 3 parents
+
+   Because the key is exact, every popped suffix belongs to a path of
+   exactly that cost, and one of its parents keeps the same key. Ties
+   are broken towards the smaller row, so that parent is popped next
+   and the row drops by one on every pop until a path completes: the
+   K answers take at most K * n pops. (Breaking ties by age instead
+   turns equal-cost regions into a breadth-first, exponential sweep.)
+   Each suffix is stored once as (column, link to the rest), so the
+   answers share storage and come out distinct by construction.
+   TC: O(n^2 + K * n * log(K * n))
+   SC: O(n^2 + K * n)
+---------------------------------------------------------------- */
+class MinFallingPathTopK {
+public:
+    struct FallingPath {
+        int cost;
+        vector<int> cols;                   // column in each row
+    };
+
+private:
+    struct Suffix {
+        int row, col;
+        int sum;                            // cells from `row` down
+        int next;                           // suffix one row below, -1 at the last row
+    };
+
+public:
+    // Up to K cheapest distinct falling paths, cheapest first.
+    vector<FallingPath> kBest(vector<vector<int>>& mat, int K) {
+        int n = mat.size();
+        vector<FallingPath> result;
+        if(n == 0 || K <= 0) return result;
+
+        // forward tabulation, padded with INT_MAX on both sides
+        vector<vector<int>> f(n, vector<int>(n + 2, INT_MAX));
+        for(int j = 0; j < n; j++) f[0][j + 1] = mat[0][j];
+        for(int i = 1; i < n; i++)
+            for(int j = 0; j < n; j++)
+                f[i][j + 1] = mat[i][j] + min({f[i - 1][j], f[i - 1][j + 1], f[i - 1][j + 2]});
+
+        vector<Suffix> nodes;
+        typedef tuple<long long, int, int> Entry;   // (key, row, node)
+        priority_queue<Entry, vector<Entry>, greater<Entry>> pq;
 
-    vector<vector<int>> mat(n, vector<int>(n));
-    for(int i = 0; i < n; i++) {
         for(int j = 0; j < n; j++) {
-            cin >> mat[i][j];
+            nodes.push_back({n - 1, j, mat[n - 1][j], -1});
+            pq.push({f[n - 1][j + 1], n - 1, j});
         }
+
+        while(!pq.empty() && (int)result.size() < K) {
+            auto [key, row, id] = pq.top();
+            pq.pop();
+            Suffix s = nodes[id];
+
+            if(s.row == 0) {
+                FallingPath p{(int)key, {}};
+                for(int k = id; k != -1; k = nodes[k].next)
+                    p.cols.push_back(nodes[k].col);
+                result.push_back(move(p));
+                continue;
+            }
+
+            for(int d = -1; d <= 1; d++) {
+                int c = s.col + d;
+                if(c < 0 || c >= n) continue;
+
+                nodes.push_back({s.row - 1, c, s.sum + mat[s.row - 1][c], id});
+                pq.push({(long long)s.sum + f[s.row - 1][c + 1], s.row - 1,
+                         (int)nodes.size() - 1});
+            }
+        }
+
+        return result;
+    }
+};
+
+/* ---------------------------------------------------------------
+   DRIVER CODE
+---------------------------------------------------------------- */
+int main(int argc, char** argv) {
+    // binary grid file (common/binary_grid.h): mmap, no parsing
+    if(argc > 1) {
+        MappedGrid file;
+        string error;
+        if(!file.open(argv[1], &error) || !checkRectangle(file.view(), 0, true, &error)) {
+            cerr << error << endl;
+            return 1;
+        }
+
+        MinFallingPathVectorized sol;
+        cout << sol.minFallingPathSum(file.view()) << endl;
+        return 0;
     }
 
-    MinFallingPathSpaceOptimized sol;
-    cout << sol.minFallingPathSum(mat) << endl;
+    FastInput in;
+    int n = in.nextInt();
+
+    // parse on a background thread while the DP consumes rows
+    PrefetchedRows rows(in.rowReader(n, n));
+
+    MinFallingPathStreaming sol;
+    cout << sol.minFallingPathSum(n, rows.reader()) << endl;
 
     return 0;
 }
\ No newline at end of file
@@ -62,6 +62,14 @@ Answer = dp[0][0][m-1]
 */
 
 #include <bits/stdc++.h>
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define CHERRY_PICKUP_X86 1
+#endif
+#include "../common/binary_grid.h"
+#include "../common/fast_input.h"
+#include "../common/row_stream.h"
+#include "../common/top_down_evaluator.h"
 using namespace std;
 
 static const int NEG_INF = -1000000000;
@@ -142,6 +150,89 @@ public:
     }
 };
 
+/*===========================================================================
+  2b. MEMOIZATION WITHOUT RECURSION (EXPLICIT STACK)
+
+  Same recurrence as solveMemo, driven by TopDownEvaluator
+  (common/top_down_evaluator.h). The recursion depth n moves to a heap
+  stack, and only the (i, j1, j2) states reachable from (0, 0, m-1) are
+  stored, in a hash map instead of an n x m x m table.
+
+  Columns are shifted by one in the key so the out-of-range neighbours
+  (-1 and m) still pack into one 64-bit key.
+
+  Time Complexity  : O(visited states * 9)
+  Space Complexity : O(visited states)
+=============================================================================*/
+
+class CherryPickupIterativeMemo {
+private:
+    struct Problem {
+        typedef uint64_t State;
+        typedef int Value;
+        typedef hash<uint64_t> Hash;
+
+        vector<vector<int>>& grid;
+        int n, m;
+
+        State key(int i, int j1, int j2) const {
+            return ((uint64_t)i * (m + 2) + (j1 + 1)) * (m + 2) + (j2 + 1);
+        }
+
+        void unpack(State k, int& i, int& j1, int& j2) const {
+            j2 = (int)(k % (m + 2)) - 1; k /= (m + 2);
+            j1 = (int)(k % (m + 2)) - 1; k /= (m + 2);
+            i  = (int)k;
+        }
+
+        int gain(int i, int j1, int j2) const {
+            return (j1 == j2) ? grid[i][j1] : grid[i][j1] + grid[i][j2];
+        }
+
+        bool isBase(const State& k, Value& out) {
+            int i, j1, j2;
+            unpack(k, i, j1, j2);
+
+            if(j1 < 0 || j1 >= m || j2 < 0 || j2 >= m) {
+                out = NEG_INF;
+                return true;
+            }
+            if(i == n - 1) {
+                out = gain(i, j1, j2);
+                return true;
+            }
+            return false;
+        }
+
+        void dependencies(const State& k, vector<State>& out) {
+            int i, j1, j2;
+            unpack(k, i, j1, j2);
+
+            for(int dj1 = -1; dj1 <= 1; dj1++)
+                for(int dj2 = -1; dj2 <= 1; dj2++)
+                    out.push_back(key(i + 1, j1 + dj1, j2 + dj2));
+        }
+
+        Value combine(const State& k, const vector<Value>& vals) {
+            int i, j1, j2;
+            unpack(k, i, j1, j2);
+
+            int best = *max_element(vals.begin(), vals.end());
+            return gain(i, j1, j2) + best;
+        }
+    };
+
+public:
+    int cherryPickup(vector<vector<int>>& grid) {
+        int n = grid.size();
+        int m = grid[0].size();
+
+        Problem problem{grid, n, m};
+        TopDownEvaluator<Problem> eval(problem);
+        return eval.evaluate(problem.key(0, 0, m - 1));
+    }
+};
+
 /*===========================================================================
   3. TABULATION (BOTTOM-UP DP)
 
@@ -261,22 +352,821 @@ public:
 };
 
 /*===========================================================================
-  DRIVER FUNCTION
+  5. SYMMETRIC HALF-STATE (PACKED TRIANGLE, POINTER SWAP)
+
+  The robots are interchangeable: gain(j1, j2) == gain(j2, j1) and both
+  move with the same 3 choices, so dp[i][j1][j2] == dp[i][j2][j1].
+  Only the triangle j1 <= j2 is stored.
+
+  LAYOUT
+  - Columns are padded by one on each side ([-1, m] -> [0, m+1]); the
+    padding stays NEG_INF forever, so no bounds checks are needed.
+  - Row a of the triangle holds b = a .. m+1, rows are laid out back to
+    back in ONE contiguous buffer per layer.
+  - row[a] points to the start of row a shifted back by a, so the cell
+    (a, b) is simply row[a][b].
+
+  TRANSITION
+  - If j2 - j1 >= 2, all 9 neighbours (j1+d1, j2+d2) still satisfy
+    j1+d1 <= j2+d2 -> read them straight from rows j1-1, j1, j1+1.
+  - The two cells closest to the diagonal (j2 - j1 <= 1) fetch mirrored
+    neighbours with (min, max).
+
+  prev / curr are swapped by pointer, no per-row copy.
+
+  Time Complexity  : O(n * m^2 / 2 * 9)
+  Space Complexity : O((m+2)^2 / 2) per layer, 2 layers
 =============================================================================*/
 
-int main() {
-    int n, m;
-    cin >> n >> m;
+class CherryPickupSymmetric {
+private:
+    // row pointers into a packed triangle over padded columns [0, M)
+    static vector<int*> rowPointers(vector<int>& buf, int M) {
+        vector<int*> row(M);
+        size_t offset = 0;
+        for(int a = 0; a < M; a++) {
+            row[a] = buf.data() + offset - a;
+            offset += M - a;
+        }
+        return row;
+    }
 
-    vector<vector<int>> grid(n, vector<int> (m));
-    for(int i = 0; i < n; i++) {
-        for(int j = 0; j < m; j++) {
-            cin >> grid[i][j];
+public:
+    int cherryPickup(vector<vector<int>>& grid) {
+        int n = grid.size();
+        int m = grid[0].size();
+        int M = m + 2;                          // padded width
+
+        size_t cells = (size_t)M * (M + 1) / 2;
+        vector<int> bufA(cells, NEG_INF), bufB(cells, NEG_INF);
+        vector<int*> prev = rowPointers(bufA, M);
+        vector<int*> curr = rowPointers(bufB, M);
+
+        auto at = [](vector<int*>& layer, int a, int b) {
+            return (a <= b) ? layer[a][b] : layer[b][a];
+        };
+
+        // padded column c <-> real column c - 1
+        for(int a = 1; a <= m; a++) {
+            for(int b = a; b <= m; b++) {
+                prev[a][b] = (a == b)
+                             ? grid[n - 1][a - 1]
+                             : grid[n - 1][a - 1] + grid[n - 1][b - 1];
+            }
         }
+
+        for(int i = n - 2; i >= 0; i--) {
+            const vector<int>& g = grid[i];
+
+            for(int a = 1; a <= m; a++) {
+                const int* up   = prev[a - 1];
+                const int* mid  = prev[a];
+                const int* down = prev[a + 1];
+                int* out = curr[a];
+
+                // near the diagonal: mirrored neighbours
+                for(int b = a; b <= min(a + 1, m); b++) {
+                    int best = NEG_INF;
+                    for(int d1 = -1; d1 <= 1; d1++)
+                        for(int d2 = -1; d2 <= 1; d2++)
+                            best = max(best, at(prev, a + d1, b + d2));
+
+                    int gain = (a == b) ? g[a - 1] : g[a - 1] + g[b - 1];
+                    out[b] = gain + best;
+                }
+
+                // strictly above the diagonal band: no checks
+                for(int b = a + 2; b <= m; b++) {
+                    int best = max({up[b - 1],   up[b],   up[b + 1],
+                                    mid[b - 1],  mid[b],  mid[b + 1],
+                                    down[b - 1], down[b], down[b + 1]});
+                    out[b] = g[a - 1] + g[b - 1] + best;
+                }
+            }
+            swap(prev, curr);
+        }
+
+        return prev[1][m];                      // (0, m-1) in padded columns
     }
+};
+
+/*===========================================================================
+  6. SEPARABLE 3x3 MAX STENCIL (VECTORIZED)
+
+  The 9-way (dj1, dj2) loop is a 3x3 max filter over the previous layer
+  plus a gain that only depends on (j1, j2):
+
+      best(j1, j2) = max over |d1|,|d2| <= 1 of prev[j1+d1][j2+d2]
+
+  A 3x3 max splits into two 1D passes:
+
+      H[j1][j2] = max(prev[j1][j2-1], prev[j1][j2], prev[j1][j2+1])
+      V[j1][j2] = max(H[j1-1][j2],    H[j1][j2],    H[j1+1][j2])
+
+  That is 4 max operations per cell instead of 8. Each pass is a straight
+  loop over contiguous ints with shifted loads and no branches: the AVX2
+  kernels do 8 cells per step with unaligned loads at offsets -1/0/+1
+  (row pass) or across the three H rows (column pass). They are picked
+  ONCE at runtime through CPUID; the scalar loops are the fallback and
+  handle the < 8 cell tails.
+
+  Then   curr = V + grid[i][j1] + grid[i][j2]
+  and the diagonal fix-up subtracts grid[i][j] once where j1 == j2.
+
+  Layers are (m+2) x (m+2) flat buffers with NEG_INF padding, H keeps
+  only 3 rolling rows, and prev / curr are swapped by pointer.
+
+  Time Complexity  : O(n * m^2)  (4 max + 2 add per cell, SIMD)
+  Space Complexity : O(m^2)
+=============================================================================*/
+
+typedef void (*RowMax3Kernel)(const int* in, int* out, int m);
+typedef void (*ColMax3Kernel)(const int* h0, const int* h1, const int* h2,
+                              const int* g, int gainA, int* out, int m);
+
+// out[b] = max(in[b-1], in[b], in[b+1]) for b in [from, m]
+static void rowMax3Tail(const int* __restrict in, int* __restrict out, int from, int m) {
+    for(int b = from; b <= m; b++)
+        out[b] = max(max(in[b - 1], in[b]), in[b + 1]);
+}
+
+// out[b] = gainA + g[b] + max(h0[b], h1[b], h2[b]) for b in [from, m]
+static void colMax3Tail(const int* __restrict h0, const int* __restrict h1,
+                        const int* __restrict h2, const int* __restrict g,
+                        int gainA, int* __restrict out, int from, int m) {
+    for(int b = from; b <= m; b++)
+        out[b] = max(max(h0[b], h1[b]), h2[b]) + gainA + g[b];
+}
+
+static void rowMax3Scalar(const int* in, int* out, int m) {
+    rowMax3Tail(in, out, 1, m);
+}
+
+static void colMax3Scalar(const int* h0, const int* h1, const int* h2,
+                          const int* g, int gainA, int* out, int m) {
+    colMax3Tail(h0, h1, h2, g, gainA, out, 1, m);
+}
+
+#ifdef CHERRY_PICKUP_X86
+__attribute__((target("avx2")))
+static void rowMax3AVX2(const int* in, int* out, int m) {
+    int b = 1;
+    for(; b + 8 <= m + 1; b += 8) {
+        __m256i l = _mm256_loadu_si256((const __m256i*)(in + b - 1));
+        __m256i c = _mm256_loadu_si256((const __m256i*)(in + b));
+        __m256i r = _mm256_loadu_si256((const __m256i*)(in + b + 1));
+        _mm256_storeu_si256((__m256i*)(out + b),
+                            _mm256_max_epi32(_mm256_max_epi32(l, c), r));
+    }
+    rowMax3Tail(in, out, b, m);
+}
+
+__attribute__((target("avx2")))
+static void colMax3AVX2(const int* h0, const int* h1, const int* h2,
+                        const int* g, int gainA, int* out, int m) {
+    const __m256i gain = _mm256_set1_epi32(gainA);
+
+    int b = 1;
+    for(; b + 8 <= m + 1; b += 8) {
+        __m256i a0 = _mm256_loadu_si256((const __m256i*)(h0 + b));
+        __m256i a1 = _mm256_loadu_si256((const __m256i*)(h1 + b));
+        __m256i a2 = _mm256_loadu_si256((const __m256i*)(h2 + b));
+        __m256i gb = _mm256_loadu_si256((const __m256i*)(g + b));
+
+        __m256i best = _mm256_max_epi32(_mm256_max_epi32(a0, a1), a2);
+        _mm256_storeu_si256((__m256i*)(out + b),
+                            _mm256_add_epi32(best, _mm256_add_epi32(gain, gb)));
+    }
+    colMax3Tail(h0, h1, h2, g, gainA, out, b, m);
+}
+#endif
+
+static RowMax3Kernel pickRowMax3Kernel() {
+#ifdef CHERRY_PICKUP_X86
+    __builtin_cpu_init();
+    if(__builtin_cpu_supports("avx2")) return rowMax3AVX2;
+#endif
+    return rowMax3Scalar;
+}
+
+static ColMax3Kernel pickColMax3Kernel() {
+#ifdef CHERRY_PICKUP_X86
+    __builtin_cpu_init();
+    if(__builtin_cpu_supports("avx2")) return colMax3AVX2;
+#endif
+    return colMax3Scalar;
+}
+
+static void rowMax3(const int* in, int* out, int m) {
+    static const RowMax3Kernel kernel = pickRowMax3Kernel();
+    kernel(in, out, m);
+}
+
+static void colMax3AddGain(const int* h0, const int* h1, const int* h2,
+                           const int* g, int gainA, int* out, int m) {
+    static const ColMax3Kernel kernel = pickColMax3Kernel();
+    kernel(h0, h1, h2, g, gainA, out, m);
+}
+
+class CherryPickupStencil {
+public:
+    // Last-row layer into a padded (m+2) x (m+2) buffer.
+    static void baseLayer(const int* row, int* layer, int m) {
+        int M = m + 2;
+        for(int a = 1; a <= m; a++) {
+            for(int b = 1; b <= m; b++) {
+                layer[a * M + b] = (a == b)
+                                   ? row[a - 1]
+                                   : row[a - 1] + row[b - 1];
+            }
+        }
+    }
+
+    // curr = layer built from `prev` (the layer below) and grid row `row`.
+    // H (3 * M) and g (M) are scratch; padding of curr is never written.
+    static void step(const int* row, const int* prev, int* curr, int m,
+                     vector<int>& H, vector<int>& g) {
+        int M = m + 2;
+
+        // gains with padded indexing: g[b] = grid[i][b - 1]
+        g.assign(M, 0);
+        copy(row, row + m, g.begin() + 1);
+
+        // rolling H rows: slot (a % 3) holds H[a]; H[0] is padding
+        H.assign(3 * (size_t)M, NEG_INF);
+        rowMax3(prev + 1 * M, H.data() + 1 * M, m);
+
+        for(int a = 1; a <= m; a++) {
+            int* hPrev = H.data() + ((a - 1) % 3) * M;
+            int* hCurr = H.data() + (a % 3) * M;
+            int* hNext = H.data() + ((a + 1) % 3) * M;
+
+            if(a + 1 <= m) rowMax3(prev + (a + 1) * M, hNext, m);
+            else           fill(hNext, hNext + M, NEG_INF);
+
+            int* out = curr + a * M;
+            colMax3AddGain(hPrev, hCurr, hNext, g.data(), g[a], out, m);
+            out[a] -= g[a];                     // j1 == j2: count once
+        }
+    }
+
+    int cherryPickup(vector<vector<int>>& grid) {
+        int n = grid.size();
+        int m = grid[0].size();
+        int M = m + 2;
+
+        vector<int> bufA((size_t)M * M, NEG_INF), bufB((size_t)M * M, NEG_INF);
+        int* prev = bufA.data();
+        int* curr = bufB.data();
+        vector<int> H, g;
+
+        baseLayer(grid[n - 1].data(), prev, m);
+        for(int i = n - 2; i >= 0; i--) {
+            step(grid[i].data(), prev, curr, m, H, g);
+            swap(prev, curr);
+        }
+
+        return prev[1 * M + m];                 // (0, m-1) in padded columns
+    }
+};
+
+/*===========================================================================
+  7. PARALLEL ROW LAYERS (PERSISTENT THREAD POOL)
+
+  Layer i depends only on layer i+1, so all m^2 states of one layer are
+  independent. The (j1, j2) plane is cut into T bands of j1 rows, one
+  band per worker, and every band runs the separable stencil of
+  section 6 on its own rows (with its own rolling H rows).
+
+  - One pool is created on first use and reused by every call.
+  - Worker k ALWAYS gets band k, and it is also the thread that first
+    writes (zero-fills) band k of both layer buffers. With first-touch
+    page placement this keeps each band's pages on the NUMA node of the
+    worker that reads and writes them.
+  - One pool.run() per layer; it returns only when every band is done,
+    which is the layer barrier.
+  - The pool (ThreadPool::shared() by default) is shared by every
+    caller: run() holds a dedicated mutex from dispatch to the final
+    wait, so concurrent cherryPickup calls serialize on the pool layer
+    by layer instead of overwriting each other's job.
+
+  Time Complexity  : O(n * m^2 / T) + O(n) pool dispatches
+  Space Complexity : O(m^2) + O(T * m)
+=============================================================================*/
+
+class ThreadPool {
+private:
+    vector<thread> workers;
+    mutex mtx;
+    mutex runMtx;                           // one run() at a time
+    condition_variable wake, done;
+    const function<void(int)>* job = nullptr;
+    long long generation = 0;
+    int pending = 0;
+    bool stopping = false;
+
+    void loop(int id) {
+        long long seen = 0;
+        while(true) {
+            unique_lock<mutex> lock(mtx);
+            wake.wait(lock, [&] { return stopping || generation != seen; });
+            if(stopping) return;
+            seen = generation;
+            lock.unlock();
+
+            (*job)(id);
+
+            lock.lock();
+            if(--pending == 0) done.notify_one();
+        }
+    }
+
+public:
+    // `threads` workers in total; the calling thread acts as worker 0.
+    explicit ThreadPool(int threads) {
+        for(int id = 1; id < threads; id++)
+            workers.emplace_back(&ThreadPool::loop, this, id);
+    }
+
+    ~ThreadPool() {
+        {
+            lock_guard<mutex> lock(mtx);
+            stopping = true;
+        }
+        wake.notify_all();
+        for(auto& w : workers) w.join();
+    }
+
+    int size() const { return workers.size() + 1; }
+
+    // Runs fn(id) once on every worker, id in [0, size()), and waits.
+    // Safe to call from several threads; the calls are serialized.
+    void run(const function<void(int)>& fn) {
+        lock_guard<mutex> running(runMtx);
+        {
+            lock_guard<mutex> lock(mtx);
+            job = &fn;
+            pending = workers.size();
+            generation++;
+        }
+        wake.notify_all();
+
+        fn(0);
+
+        unique_lock<mutex> lock(mtx);
+        done.wait(lock, [&] { return pending == 0; });
+    }
+
+    static ThreadPool& shared() {
+        static ThreadPool pool(max(1u, thread::hardware_concurrency()));
+        return pool;
+    }
+};
+
+class CherryPickupParallel {
+private:
+    ThreadPool& pool;
+
+public:
+    explicit CherryPickupParallel(ThreadPool& pool = ThreadPool::shared()) : pool(pool) {}
+
+    int cherryPickup(vector<vector<int>>& grid) {
+        int n = grid.size();
+        int m = grid[0].size();
+        int M = m + 2;
+        int T = pool.size();
+
+        // Left uninitialised here: each worker first-touches its own band.
+        unique_ptr<int[]> bufA(new int[(size_t)M * M]);
+        unique_ptr<int[]> bufB(new int[(size_t)M * M]);
+        int* prev = bufA.get();
+        int* curr = bufB.get();
+
+        vector<vector<int>> scratch(T);     // per-worker: 3 H rows + gains
+
+        // band k covers padded rows [bandLo(k), bandLo(k + 1))
+        auto bandLo = [&](int k) { return 1 + (int)((long long)m * k / T); };
+
+        pool.run([&](int k) {
+            int lo = bandLo(k), hi = bandLo(k + 1);
+            if(k == 0) lo = 0;              // padding row 0
+            if(k == T - 1) hi = M;          // padding row m + 1
+
+            fill(prev + (size_t)lo * M, prev + (size_t)hi * M, NEG_INF);
+            fill(curr + (size_t)lo * M, curr + (size_t)hi * M, NEG_INF);
+            scratch[k].assign(4 * (size_t)M, NEG_INF);
+
+            for(int a = max(lo, 1); a < min(hi, m + 1); a++) {
+                for(int b = 1; b <= m; b++) {
+                    prev[(size_t)a * M + b] = (a == b)
+                                              ? grid[n - 1][a - 1]
+                                              : grid[n - 1][a - 1] + grid[n - 1][b - 1];
+                }
+            }
+        });
+
+        for(int i = n - 2; i >= 0; i--) {
+            pool.run([&](int k) {
+                int lo = bandLo(k), hi = bandLo(k + 1);
+                if(lo >= hi) return;
+
+                int* H = scratch[k].data();
+                int* g = H + 3 * (size_t)M;
+                g[0] = g[M - 1] = 0;
+                copy(grid[i].begin(), grid[i].end(), g + 1);
+
+                // H slot (a % 3) holds the row max of prev row a
+                rowMax3(prev + (size_t)(lo - 1) * M, H + ((lo - 1) % 3) * M, m);
+                rowMax3(prev + (size_t)lo * M, H + (lo % 3) * M, m);
+
+                for(int a = lo; a < hi; a++) {
+                    int* hNext = H + ((a + 1) % 3) * M;
+                    rowMax3(prev + (size_t)(a + 1) * M, hNext, m);
+
+                    int* out = curr + (size_t)a * M;
+                    colMax3AddGain(H + ((a - 1) % 3) * M, H + (a % 3) * M, hNext,
+                                   g, g[a], out, m);
+                    out[a] -= g[a];         // j1 == j2: count once
+                }
+            });
+            swap(prev, curr);
+        }
+
+        return prev[1 * M + m];
+    }
+};
+
+/*===========================================================================
+  8. GENERALIZED K-ROBOT ENGINE (SORTED STATES, SEPARABLE PASSES)
+
+  With k robots the state is (c_1, ..., c_k). Robots are interchangeable,
+  so the value only depends on the MULTISET of columns: store only
+  sorted tuples c_1 <= ... <= c_k, i.e. C(m+k-1, k) states instead of m^k.
+
+  FLAT INDEX (combinatorial number system)
+  - Sorted c maps to strictly increasing e_t = c_t + t.
+  - rank(c) = sum over t of C(e_t, t + 1)   (colex order)
+  - Walking tuples in rank order is a simple successor step, so whole
+    layers are filled with a running index.
+
+  SEPARABLE TRANSITION
+  Instead of 3^k neighbours, take the max one coordinate at a time:
+
+      G_0 = F(i+1)
+      G_j(x) = max over d in {-1,0,+1} of G_(j-1)(x with x_j + d)
+
+  G_j is symmetric inside the first j coordinates (already maximised)
+  and inside the last k - j (untouched), so it is stored as a pair of
+  sorted tuples (A of size j, B of size k - j):
+
+      G_j(A, B) = max_d G_(j-1)(A minus a, B plus (a + d)),  a = max(A)
+
+  G_k(A) is the full 3^k max; add the gain of the distinct columns.
+
+  Time Complexity  : O(n * 3k * 2^k * C(m+k-1, k))   (vs 3^k * m^k)
+  Space Complexity : O(max over j of |G_j|) <= O(C(k, k/2) * C(m+k-1, k))
+=============================================================================*/
+
+template<int K>
+class CherryPickupKRobots {
+private:
+    int m = 0;
+    vector<vector<size_t>> binom;
+
+    size_t C(int x, int y) const { return (y < 0 || x < y) ? 0 : binom[x][y]; }
+
+    // number of sorted s-tuples over [0, m)
+    size_t count(int s) const { return C(m + s - 1, s); }
+
+    size_t rank(const int* c, int s) const {
+        size_t r = 0;
+        for(int t = 0; t < s; t++) r += C(c[t] + t, t + 1);
+        return r;
+    }
+
+    // colex successor of a sorted s-tuple; false after the last one
+    bool next(int* c, int s) const {
+        for(int t = 0; t < s; t++) {
+            bool canStep = (t + 1 < s) ? (c[t] < c[t + 1]) : (c[t] + 1 < m);
+            if(canStep) {
+                c[t]++;
+                for(int u = 0; u < t; u++) c[u] = 0;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    static int gain(const vector<int>& row, const int* c) {
+        int total = 0;
+        for(int t = 0; t < K; t++)
+            if(t == 0 || c[t] != c[t - 1]) total += row[c[t]];
+        return total;
+    }
+
+public:
+    int cherryPickup(vector<vector<int>>& grid, array<int, K> start) {
+        int n = grid.size();
+        m = grid[0].size();
+
+        binom.assign(m + K + 1, vector<size_t>(K + 2, 0));
+        for(int x = 0; x <= m + K; x++) {
+            binom[x][0] = 1;
+            for(int y = 1; y <= min(x, K + 1); y++)
+                binom[x][y] = binom[x - 1][y - 1] + (y <= x - 1 ? binom[x - 1][y] : 0);
+        }
+
+        vector<int> F(count(K)), G, H;
+        int c[K + 1], A[K + 1], B[K + 1], merged[K + 1];
+
+        fill(c, c + K, 0);
+        size_t r = 0;
+        do { F[r++] = gain(grid[n - 1], c); } while(next(c, K));
+
+        for(int i = n - 2; i >= 0; i--) {
+            G = F;                                  // layout (A: 0, B: K)
+
+            for(int j = 1; j <= K; j++) {
+                size_t cntA = count(j), cntB = count(K - j), oldB = count(K - j + 1);
+                H.assign(cntA * cntB, NEG_INF);
+
+                fill(A, A + j, 0);
+                size_t rankA = 0, idx = 0;
+                do {
+                    int a = A[j - 1];
+                    size_t prefix = rankA - C(a + j - 1, j);    // rank of A minus a
+
+                    fill(B, B + K - j, 0);
+                    do {
+                        int best = NEG_INF;
+                        for(int d = -1; d <= 1; d++) {
+                            int x = a + d;
+                            if(x < 0 || x >= m) continue;
+
+                            // merged = B plus x, kept sorted
+                            int p = 0, q = 0;
+                            while(q < K - j && B[q] < x) merged[p++] = B[q++];
+                            merged[p++] = x;
+                            while(q < K - j) merged[p++] = B[q++];
+
+                            best = max(best, G[prefix * oldB + rank(merged, K - j + 1)]);
+                        }
+                        H[idx++] = best;
+                    } while(next(B, K - j));
+
+                    rankA++;
+                } while(next(A, j));
+
+                G.swap(H);
+            }
+
+            fill(c, c + K, 0);
+            r = 0;
+            do { F[r] = gain(grid[i], c) + G[r]; r++; } while(next(c, K));
+        }
+
+        sort(start.begin(), start.end());
+        return F[rank(start.data(), K)];
+    }
+};
+
+/*===========================================================================
+  9. PATH RECONSTRUCTION (SQRT(n) CHECKPOINTS)
+
+  To recover the robots' columns, walk forward from (0, 0, m-1): at row
+  i, move to the (j1 + d1, j2 + d2) with the best dp[i+1] value. That
+  needs every layer, i.e. the full n x m x m table, in forward order,
+  while the DP produces them backwards.
+
+  CHECKPOINTING
+  - Bottom-up pass: keep only every B-th layer (B = sqrt(n)), counting
+    from the last row.
+  - Forward walk, one segment at a time starting from the top: rebuild
+    the layers of the segment from the checkpoint below it, walk through
+    them, drop them.
+
+  Every layer is built at most twice (< 2x compute), and at most
+  (n / B) checkpoints + B segment layers are alive at once.
+
+  Layers use the padded (m+2) x (m+2) layout and the stencil step of
+  section 6.
+
+  Time Complexity  : O(2 * n * m^2)
+  Space Complexity : O(m^2 * sqrt(n))
+=============================================================================*/
+
+class CherryPickupPathReconstruction {
+public:
+    // Returns the best score and fills both robots' column per row.
+    int cherryPickup(vector<vector<int>>& grid,
+                     vector<int>& path1, vector<int>& path2) {
+        int n = grid.size();
+        int m = grid[0].size();
+        int M = m + 2;
+        size_t cells = (size_t)M * M;
+
+        int B = max(1, (int)ceil(sqrt((double)n)));
+        vector<int> H, g;
+
+        // checkpoint rows n-1, n-1-B, n-1-2B, ... (descending)
+        vector<int> cpRow;
+        vector<vector<int>> cpLayer;
+
+        vector<int> layer(cells, NEG_INF), below(cells, NEG_INF);
+        CherryPickupStencil::baseLayer(grid[n - 1].data(), layer.data(), m);
+        for(int i = n - 1; i >= 0; i--) {
+            if(i < n - 1) {
+                layer.swap(below);
+                CherryPickupStencil::step(grid[i].data(), below.data(), layer.data(), m, H, g);
+            }
+            if((n - 1 - i) % B == 0) {
+                cpRow.push_back(i);
+                cpLayer.push_back(layer);
+            }
+        }
+        int best = layer[1 * M + m];
+
+        path1.assign(n, 0);
+        path2.assign(n, 0);
+        int j1 = 1, j2 = m;                     // padded columns
+
+        // segment t: rows [lo, cpRow[t]) use layers (lo, cpRow[t]]
+        for(int t = cpRow.size() - 1; t >= 0; t--) {
+            int hi = cpRow[t];
+            int lo = (t + 1 < (int)cpRow.size()) ? cpRow[t + 1] : 0;
+
+            // seg[r - lo - 1] = layer r, for r in (lo, hi]
+            vector<vector<int>> seg(hi - lo);
+            if(hi > lo) {
+                seg.back() = cpLayer[t];
+                for(int r = hi - 1; r > lo; r--) {
+                    seg[r - lo - 1].assign(cells, NEG_INF);
+                    CherryPickupStencil::step(grid[r].data(), seg[r - lo].data(),
+                                              seg[r - lo - 1].data(), m, H, g);
+                }
+            }
+
+            for(int i = lo; i < hi; i++) {
+                path1[i] = j1 - 1;
+                path2[i] = j2 - 1;
+
+                const int* nxt = seg[i - lo].data();    // layer i + 1
+                int bestVal = NEG_INF, b1 = j1, b2 = j2;
+                for(int d1 = -1; d1 <= 1; d1++) {
+                    for(int d2 = -1; d2 <= 1; d2++) {
+                        int v = nxt[(j1 + d1) * M + (j2 + d2)];
+                        if(v > bestVal) {
+                            bestVal = v;
+                            b1 = j1 + d1;
+                            b2 = j2 + d2;
+                        }
+                    }
+                }
+                j1 = b1;
+                j2 = b2;
+            }
+
+            cpLayer.pop_back();
+        }
+
+        path1[n - 1] = j1 - 1;
+        path2[n - 1] = j2 - 1;
+        return best;
+    }
+};
+
+/*===========================================================================
+  10. STREAMING ROWS (TOP-DOWN, NO GRID IN MEMORY)
+
+  Every engine above runs bottom-up from row n-1, so it needs the whole
+  grid before it can start. For row-at-a-time input (RowReader from
+  common/row_stream.h) flip the direction:
+
+      f[i][j1][j2] = most cherries collected on the way from (0, 0, m-1)
+                     to row i with the robots at (j1, j2)
+
+      f[0]      = gain at (0, m-1), every other state unreachable
+      f[i]      = gain(i) + 3x3 max of f[i-1]      (same neighbourhood)
+      answer    = max over f[n-1]
+
+  The 3x3 max uses the separable passes of section 6. Unreachable states
+  stay pinned at NEG_INF instead of drifting upward by the gains.
+
+  Only the incoming row and two m x m layers are resident, so the grid
+  never has to fit in memory (the layers themselves are O(m^2)).
+
+  Time Complexity  : O(n * m^2)
+  Space Complexity : O(m^2) + O(m) input
+=============================================================================*/
+
+class CherryPickupStreaming {
+public:
+    int cherryPickup(int m, const RowReader& nextRow) {
+        int M = m + 2;
+
+        vector<int> row;
+        if(!nextRow(row)) return 0;
+
+        vector<int> bufA((size_t)M * M, NEG_INF), bufB((size_t)M * M, NEG_INF);
+        int* prev = bufA.data();
+        int* curr = bufB.data();
+        vector<int> H(3 * (size_t)M, NEG_INF), g(M, 0);
+
+        prev[1 * M + m] = (m == 1) ? row[0] : row[0] + row[m - 1];
+
+        while(nextRow(row)) {
+            copy(row.begin(), row.end(), g.begin() + 1);
+
+            fill(H.begin(), H.end(), NEG_INF);
+            rowMax3(prev + 1 * M, H.data() + 1 * M, m);
+
+            for(int a = 1; a <= m; a++) {
+                int* hPrev = H.data() + ((a - 1) % 3) * M;
+                int* hCurr = H.data() + (a % 3) * M;
+                int* hNext = H.data() + ((a + 1) % 3) * M;
+
+                if(a + 1 <= m) rowMax3(prev + (a + 1) * M, hNext, m);
+                else           fill(hNext, hNext + M, NEG_INF);
+
+                int* out = curr + a * M;
+                for(int b = 1; b <= m; b++) {
+                    int best = max(max(hPrev[b], hCurr[b]), hNext[b]);
+                    int gain = (a == b) ? g[a] : g[a] + g[b];
+                    out[b] = (best == NEG_INF) ? NEG_INF : best + gain;
+                }
+            }
+            swap(prev, curr);
+        }
+
+        int best = NEG_INF;
+        for(int a = 1; a <= m; a++)
+            for(int b = 1; b <= m; b++)
+                best = max(best, prev[a * M + b]);
+        return best;
+    }
+};
+
+/*===========================================================================
+  11. ZERO-COPY BINARY GRID (MMAP)
+
+  Same engine as section 6, but the grid is a GridView into a mapped
+  binary file (common/binary_grid.h): rows are read in place, nothing is
+  parsed, copied or allocated per row.
+
+  Time Complexity  : O(n * m^2)
+  Space Complexity : O(m^2)  (+ the mapping, paged in by the OS)
+=============================================================================*/
+
+class CherryPickupMapped {
+public:
+    int cherryPickup(const GridView& grid) {
+        int n = grid.rows();
+        int m = grid.rowLength(0);
+        int M = m + 2;
+
+        vector<int> bufA((size_t)M * M, NEG_INF), bufB((size_t)M * M, NEG_INF);
+        int* prev = bufA.data();
+        int* curr = bufB.data();
+        vector<int> H, g;
+
+        CherryPickupStencil::baseLayer(grid.row(n - 1), prev, m);
+        for(int i = n - 2; i >= 0; i--) {
+            CherryPickupStencil::step(grid.row(i), prev, curr, m, H, g);
+            swap(prev, curr);
+        }
+
+        return prev[1 * M + m];
+    }
+};
+
+/*===========================================================================
+  DRIVER FUNCTION
+=============================================================================*/
+
+int main(int argc, char** argv) {
+    // binary grid file (common/binary_grid.h): mmap, no parsing
+    if(argc > 1) {
+        MappedGrid file;
+        string error;
+        if(!file.open(argv[1], &error) || !checkRectangle(file.view(), 0, false, &error)) {
+            cerr << error << endl;
+            return 1;
+        }
+
+        CherryPickupMapped Sol;
+        cout << Sol.cherryPickup(file.view()) << endl;
+        return 0;
+    }
+
+    FastInput in;
+    int n = in.nextInt();
+    int m = in.nextInt();
+
+    // parse on a background thread while the DP consumes rows
+    PrefetchedRows rows(in.rowReader(n, m));
 
-    CherryPickupSpaceOptimized Sol;
-    cout << Sol.cherryPickup(grid) << endl;
+    CherryPickupStreaming Sol;
+    cout << Sol.cherryPickup(m, rows.reader()) << endl;
 
     return 0;
 }
\ No newline at end of file
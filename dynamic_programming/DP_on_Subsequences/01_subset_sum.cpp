@@ -72,6 +72,16 @@ Time Complexity:
 - Memoization      : O(n * sum)
 - Tabulation       : O(n * sum)
 - Space Optimized  : O(n * sum)
+- Bitset Shift-OR  : O(n * sum / 64)   (O(n * sum / 512) with AVX-512)
+- Batched Queries  : O(n * maxTarget / 64 + k), O(n + k) when cached
+- Incremental Index: O(sum) per insert/erase, O(1) per contains
+- Meet in Middle   : O(2^(n/2))
+- Binary Splitting : O(sum / 64 * sum(log c))   (c = copies per value)
+- Bounded Window   : O(distinct * sum)
+- Reconstruction   : O(n * sum / 64)   (each row built at most twice)
+- Multithreaded    : O(n * sum / (64 * T)) on T threads
+- Semiring DP      : O(n * sum)   (count / mod count / min cardinality)
+- Iterative Memo   : O(visited states)
 
 Space Complexity:
 - Recursion        : O(n)
@@ -79,12 +89,26 @@ Space Complexity:
 - Tabulation       : O(n * sum)
 - 2 Arrays         : O(sum)
 - 1 Array          : O(sum)
+- Bitset Shift-OR  : O(sum / 64) words
+- Batched Queries  : O(maxTarget / 64) words per cached array
+- Incremental Index: O(sum)
+- Meet in Middle   : O(2^(n/2))
+- Multiplicity     : O(sum)
+- Reconstruction   : O(sqrt(n) * sum / 64) words
+- Multithreaded    : O(2 * sum / 64) words
+- Semiring DP      : O(sum)   (O(n * sum) for the full table)
+- Iterative Memo   : O(visited states), no recursion
 
 ============================================================================
 */
 
 
 #include <bits/stdc++.h>
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define SUBSET_SUM_X86 1
+#endif
+#include "../common/top_down_evaluator.h"
 using namespace std;
 
 /*
@@ -157,6 +181,65 @@ public:
 };
 
 
+/*
+============================================================================
+2b. TOP-DOWN DP WITHOUT RECURSION (EXPLICIT STACK)
+============================================================================
+Same recurrence as SubsetSumMemoized, driven by TopDownEvaluator
+(common/top_down_evaluator.h): the call stack lives on the heap, so
+n = 1e6 does not overflow, and only the (ind, sum) states actually
+reached from (n - 1, sum) are stored, in a hash map.
+
+State (ind, s) is packed into one 64-bit key.
+
+TIME COMPLEXITY: O(visited states)
+SPACE COMPLEXITY: O(visited states)
+============================================================================
+*/
+class SubsetSumIterative {
+private:
+    struct Problem {
+        typedef uint64_t State;
+        typedef bool Value;
+        typedef hash<uint64_t> Hash;
+
+        vector<int>& arr;
+
+        static State key(int ind, int s) { return ((uint64_t)ind << 32) | (uint32_t)s; }
+        static int indOf(State k) { return k >> 32; }
+        static int sumOf(State k) { return (uint32_t)k; }
+
+        bool isBase(const State& k, Value& out) {
+            int ind = indOf(k), s = sumOf(k);
+            if(s == 0) { out = true; return true; }
+            if(ind == 0) { out = (arr[0] == s); return true; }
+            return false;
+        }
+
+        void dependencies(const State& k, vector<State>& out) {
+            int ind = indOf(k), s = sumOf(k);
+            out.push_back(key(ind - 1, s));                 // notTake
+            if(arr[ind] <= s)
+                out.push_back(key(ind - 1, s - arr[ind]));  // take
+        }
+
+        Value combine(const State&, const vector<Value>& vals) {
+            for(bool v : vals) if(v) return true;
+            return false;
+        }
+    };
+
+public:
+    bool isSubsetSum(vector<int>& arr, int sum) {
+        if(arr.empty() || sum < 0) return false;
+
+        Problem problem{arr};
+        TopDownEvaluator<Problem> eval(problem);
+        return eval.evaluate(Problem::key(arr.size() - 1, sum));
+    }
+};
+
+
 /*
 ============================================================================
 3. BOTTOM-UP DP (TABULATION)
@@ -260,6 +343,1030 @@ public:
 };
 
 
+/*
+============================================================================
+6. BITSET SHIFT-OR (WORD-PACKED 1D DP)
+============================================================================
+Reading the 1D transition as a whole-row operation:
+
+    dp[s] |= dp[s - arr[ind]]   for every s   ==>   dp |= dp << arr[ind]
+
+Bit `s` of the bitset is set iff sum `s` is reachable. Packing 64 sums
+per uint64_t word lets one OR handle 64 targets at once.
+
+std::bitset needs its size at compile time, so the words live in a
+vector sized from `sum` at runtime.
+
+In-place shift-OR:
+    Walk words from HIGH to LOW. Word w reads words (w - q) and
+    (w - q - 1), which are lower and therefore not yet updated in
+    this pass -> each element is still used at most once.
+
+TIME COMPLEXITY: O(n * sum / 64)
+SPACE COMPLEXITY: O(sum / 64) words
+============================================================================
+*/
+/*
+----------------------------------------------------------------------------
+SHIFT-OR KERNELS
+----------------------------------------------------------------------------
+w[i] |= (w[i - q] << r) | (w[i - q - 1] >> (64 - r)),  q = shift / 64,
+                                                      r = shift % 64
+
+The word-level shift crosses 64-bit lanes, so the vector kernels do NOT
+shift whole registers. Instead they load the two source windows
+(w + i - q) and (w + i - q - 1) unaligned, which lines every lane up with
+its own two source words, and then shift per 64-bit lane.
+
+Packed shifts by a count >= 64 produce 0, so r == 0 needs no special case
+in the vector kernels.
+
+A block [i, i + V) reads words <= i + V - 1 - q. Those are either lower
+than the block (not yet written) or inside it (loaded before the store),
+so the high-to-low walk stays correct for every q.
+
+The kernel is picked ONCE at runtime through CPUID, so one binary runs
+on every x86 machine and still uses the widest unit available.
+----------------------------------------------------------------------------
+*/
+typedef void (*ShiftOrKernel)(uint64_t* w, int nw, int shift);
+
+// Handles words [lo, hi] high-to-low, plus the partial word w[q].
+static void shiftOrTail(uint64_t* w, int lo, int hi, int shift) {
+    int q = shift >> 6, r = shift & 63;
+
+    if(r == 0) {
+        for(int i = hi; i >= lo && i >= q; i--)
+            w[i] |= w[i - q];
+        return;
+    }
+
+    for(int i = hi; i >= lo && i > q; i--)
+        w[i] |= (w[i - q] << r) | (w[i - q - 1] >> (64 - r));
+    if(lo <= q && q <= hi) w[q] |= w[0] << r;
+}
+
+static void shiftOrScalar(uint64_t* w, int nw, int shift) {
+    shiftOrTail(w, 0, nw - 1, shift);
+}
+
+#ifdef SUBSET_SUM_X86
+__attribute__((target("avx2")))
+static void shiftOrAVX2(uint64_t* w, int nw, int shift) {
+    int q = shift >> 6, r = shift & 63;
+    __m128i left  = _mm_cvtsi32_si128(r);
+    __m128i right = _mm_cvtsi32_si128(64 - r);
+
+    int i = nw - 4;
+    for(; i >= q + 1; i -= 4) {
+        __m256i a = _mm256_loadu_si256((const __m256i*)(w + i - q));
+        __m256i b = _mm256_loadu_si256((const __m256i*)(w + i - q - 1));
+        __m256i d = _mm256_loadu_si256((const __m256i*)(w + i));
+        __m256i v = _mm256_or_si256(_mm256_sll_epi64(a, left),
+                                    _mm256_srl_epi64(b, right));
+        _mm256_storeu_si256((__m256i*)(w + i), _mm256_or_si256(d, v));
+    }
+    shiftOrTail(w, 0, i + 3, shift);
+}
+
+__attribute__((target("avx512f")))
+static void shiftOrAVX512(uint64_t* w, int nw, int shift) {
+    int q = shift >> 6, r = shift & 63;
+    __m128i left  = _mm_cvtsi32_si128(r);
+    __m128i right = _mm_cvtsi32_si128(64 - r);
+    const __mmask8 all = 0xFF;
+
+    int i = nw - 8;
+    for(; i >= q + 1; i -= 8) {
+        __m512i a = _mm512_loadu_si512(w + i - q);
+        __m512i b = _mm512_loadu_si512(w + i - q - 1);
+        __m512i d = _mm512_loadu_si512(w + i);
+        __m512i v = _mm512_or_si512(_mm512_maskz_sll_epi64(all, a, left),
+                                    _mm512_maskz_srl_epi64(all, b, right));
+        _mm512_storeu_si512(w + i, _mm512_or_si512(d, v));
+    }
+    shiftOrTail(w, 0, i + 7, shift);
+}
+#endif
+
+static ShiftOrKernel pickShiftOrKernel() {
+#ifdef SUBSET_SUM_X86
+    __builtin_cpu_init();
+    if(__builtin_cpu_supports("avx512f")) return shiftOrAVX512;
+    if(__builtin_cpu_supports("avx2"))    return shiftOrAVX2;
+#endif
+    return shiftOrScalar;
+}
+
+static ShiftOrKernel shiftOrKernel() {
+    static const ShiftOrKernel kernel = pickShiftOrKernel();
+    return kernel;
+}
+
+class ReachableSums {
+private:
+    vector<uint64_t> words;
+    int limit;                      // highest tracked sum
+
+    // bits above `limit` in the last word; limit + 1 itself could
+    // overflow at limit == INT_MAX, so count from limit's own bit
+    void clearTail() {
+        int tail = (limit & 63) + 1;
+        if(tail < 64) words.back() &= (1ULL << tail) - 1;
+    }
+
+public:
+    explicit ReachableSums(int limit) : words(limit / 64 + 1, 0), limit(limit) {
+        words[0] = 1;               // empty subset -> sum 0
+    }
+
+    int maxSum() const { return limit; }
+    int wordCount() const { return words.size(); }
+    uint64_t* data() { return words.data(); }
+    const uint64_t* data() const { return words.data(); }
+
+    bool test(int s) const {
+        if(s < 0 || s > limit) return false;
+        return (words[s >> 6] >> (s & 63)) & 1;
+    }
+
+    // dp |= dp << shift
+    void addItem(int shift) {
+        if(shift <= 0 || shift > limit) return;
+
+        shiftOrKernel()(words.data(), words.size(), shift);
+        clearTail();
+    }
+};
+
+class SubsetSumBitset {
+public:
+    bool isSubsetSum(vector<int>& arr, int sum) {
+        if(arr.empty() || sum < 0) return false;
+
+        ReachableSums dp(sum);
+        for(int x : arr) {
+            dp.addItem(x);
+            if(dp.test(sum)) return true;   // early exit
+        }
+
+        return dp.test(sum);
+    }
+};
+
+
+/*
+============================================================================
+7. BATCHED MULTI-TARGET QUERIES (ONE SWEEP + CACHE)
+============================================================================
+One DP up to max(targets) answers EVERY target <= that bound, so a batch
+of k queries costs one sweep instead of k.
+
+Nothing above sum(arr) is ever reachable, so the table is capped at
+min(max target, sum(arr)). A table built up to sum(arr) is therefore
+complete for that item set and never needs rebuilding.
+
+CACHE:
+    Tables are kept per array fingerprint (hash of the items). The items
+    are stored next to the table, so a hash collision just forces a
+    rebuild instead of returning a wrong answer.
+
+TIME COMPLEXITY:
+    - Cold batch : O(n * maxTarget / 64 + k)
+    - Warm batch : O(n + k)      (fingerprint + one bit test per target)
+SPACE COMPLEXITY: O(maxTarget / 64) words per cached array
+============================================================================
+*/
+class SubsetSumBatch {
+private:
+    struct Entry {
+        vector<int> items;
+        ReachableSums table;
+    };
+
+    unordered_map<uint64_t, Entry> cache;
+
+    static uint64_t fingerprint(const vector<int>& arr) {
+        uint64_t h = 1469598103934665603ULL ^ arr.size();
+        for(int x : arr) {
+            h ^= (uint32_t)x;
+            h *= 1099511628211ULL;
+        }
+        return h;
+    }
+
+    static long long totalSum(const vector<int>& arr) {
+        long long total = 0;
+        for(int x : arr) total += x;
+        return total;
+    }
+
+    const ReachableSums& tableFor(vector<int>& arr, int maxTarget) {
+        int limit = (int)min<long long>(maxTarget, totalSum(arr));
+        uint64_t key = fingerprint(arr);
+
+        auto it = cache.find(key);
+        if(it != cache.end() && it->second.items == arr &&
+           it->second.table.maxSum() >= limit)
+            return it->second.table;
+
+        ReachableSums table(limit);
+        for(int x : arr) table.addItem(x);
+
+        if(it != cache.end()) cache.erase(it);
+        return cache.emplace(key, Entry{arr, move(table)}).first->second.table;
+    }
+
+public:
+    vector<bool> isSubsetSum(vector<int>& arr, vector<int>& targets) {
+        vector<bool> result(targets.size(), false);
+        if(arr.empty() || targets.empty()) return result;
+
+        int maxTarget = *max_element(targets.begin(), targets.end());
+        if(maxTarget < 0) return result;
+
+        const ReachableSums& dp = tableFor(arr, maxTarget);
+        for(size_t i = 0; i < targets.size(); i++)
+            result[i] = dp.test(targets[i]);
+
+        return result;
+    }
+
+    void clearCache() { cache.clear(); }
+};
+
+
+/*
+============================================================================
+8. INCREMENTAL INDEX (INSERT / ERASE ITEMS)
+============================================================================
+A live item set that changes a few items at a time should not rebuild the
+whole table after every change.
+
+COUNTING MODE (supports erase):
+    ways[s] = number of subsets with sum s  (mod P)
+
+    insert x : for s = maxSum .. x   ways[s] += ways[s - x]   (right-to-left)
+    erase  x : for s = x .. maxSum   ways[s] -= ways[s - x]   (left-to-right)
+
+    Erase is the exact inverse of insert, because the 0/1 knapsack
+    update is a polynomial multiply by (1 + z^x) and ways[] is the
+    coefficient list.
+
+    contains(s) = (ways[s] != 0), with P = 2^61 - 1. Only add/subtract
+    is needed, so no 128-bit multiply.
+
+    LIMITATION (deterministic, not probabilistic): counts and P are
+    both fixed, so contains(s) is false for a reachable s whose count
+    is a multiple of P. A count is at most 2^(live items), so with
+    fewer than 61 positive items every answer is exact; beyond that an
+    adversarial (or unlucky) item set can hide a reachable sum. Use
+    REACHABILITY_ONLY when exactness matters more than erase.
+
+REACHABILITY MODE (insert only):
+    Plain bitset from section 6: insert is one shift-OR. OR cannot be
+    undone, so erase is rejected in this mode.
+
+Zeros never change which sums are reachable, so they are only counted,
+never applied to the table.
+
+TIME COMPLEXITY:
+    - insert   : O(maxSum) counting, O(maxSum / 64) reachability
+    - erase    : O(maxSum) counting
+    - contains : O(1)
+SPACE COMPLEXITY: O(maxSum)
+============================================================================
+*/
+class SubsetSumIndex {
+public:
+    enum Mode { COUNTING, REACHABILITY_ONLY };
+
+private:
+    static const uint64_t MOD = (1ULL << 61) - 1;
+
+    Mode mode;
+    int limit;
+    vector<uint64_t> ways;          // COUNTING
+    ReachableSums reach;            // REACHABILITY_ONLY
+    unordered_map<int, int> items;  // multiset of live items
+    int itemCount = 0;
+
+public:
+    SubsetSumIndex(int maxSum, Mode mode = COUNTING)
+        : mode(mode), limit(maxSum),
+          reach(mode == REACHABILITY_ONLY ? maxSum : 0) {
+        if(mode == COUNTING) {
+            ways.assign(maxSum + 1, 0);
+            ways[0] = 1;
+        }
+    }
+
+    void insert(int x) {
+        items[x]++;
+        itemCount++;
+        if(x <= 0 || x > limit) return;
+
+        if(mode == REACHABILITY_ONLY) {
+            reach.addItem(x);
+            return;
+        }
+
+        for(int s = limit; s >= x; s--) {
+            uint64_t v = ways[s] + ways[s - x];
+            ways[s] = (v >= MOD) ? v - MOD : v;
+        }
+    }
+
+    // Returns false if x is not in the set or the mode cannot erase.
+    bool erase(int x) {
+        if(mode != COUNTING) return false;
+
+        auto it = items.find(x);
+        if(it == items.end()) return false;
+        if(--it->second == 0) items.erase(it);
+        itemCount--;
+        if(x <= 0 || x > limit) return true;
+
+        for(int s = x; s <= limit; s++) {
+            uint64_t v = ways[s] + MOD - ways[s - x];
+            ways[s] = (v >= MOD) ? v - MOD : v;
+        }
+        return true;
+    }
+
+    bool contains(int s) const {
+        if(s < 0 || s > limit) return false;
+        if(mode == REACHABILITY_ONLY) return reach.test(s);
+        return ways[s] != 0;
+    }
+
+    int size() const { return itemCount; }
+};
+
+
+/*
+============================================================================
+9. MEET IN THE MIDDLE (SMALL n, HUGE sum)
+============================================================================
+Every DP above costs O(sum) memory at least, which is hopeless for
+sum ~ 1e12. When n is small (<= ~40) enumerate subsets instead:
+
+    - split arr into halves A and B
+    - list all 2^(n/2) subset sums of each half, SORTED
+    - two-pointer join: a from smallest A, b from largest B
+          a + b < sum -> advance a
+          a + b > sum -> retreat b
+          a + b == sum -> found
+
+SORTED ENUMERATION WITHOUT SORTING:
+    sums(items + x) = merge(sums(items), sums(items) + x)
+    Both inputs are already sorted, so each item costs one linear merge
+    and the whole list is built in O(2^(n/2)) instead of O(2^(n/2) log).
+
+The two halves are independent, so they are enumerated in parallel.
+The join is two sequential scans -> cache friendly.
+
+TIME COMPLEXITY: O(2^(n/2))
+SPACE COMPLEXITY: O(2^(n/2))
+============================================================================
+*/
+class SubsetSumMeetInMiddle {
+private:
+    static vector<long long> sortedSubsetSums(const vector<long long>& items) {
+        vector<long long> sums(1, 0), next;
+
+        for(long long x : items) {
+            next.resize(sums.size() * 2);
+            size_t i = 0, j = 0, k = 0, sz = sums.size();
+
+            while(i < sz && j < sz) {
+                if(sums[i] <= sums[j] + x) next[k++] = sums[i++];
+                else                       next[k++] = sums[j++] + x;
+            }
+            while(i < sz) next[k++] = sums[i++];
+            while(j < sz) next[k++] = sums[j++] + x;
+
+            sums.swap(next);
+        }
+        return sums;
+    }
+
+public:
+    bool isSubsetSum(vector<long long>& arr, long long sum) {
+        if(arr.empty() || sum < 0) return false;
+
+        size_t half = arr.size() / 2;
+        vector<long long> left(arr.begin(), arr.begin() + half);
+        vector<long long> right(arr.begin() + half, arr.end());
+
+        auto pending = async(launch::async, sortedSubsetSums, cref(left));
+        vector<long long> B = sortedSubsetSums(right);
+        vector<long long> A = pending.get();
+
+        size_t i = 0;
+        long long j = (long long)B.size() - 1;
+        while(i < A.size() && j >= 0) {
+            long long curr = A[i] + B[j];
+            if(curr == sum) return true;
+            if(curr < sum) i++;
+            else j--;
+        }
+        return false;
+    }
+
+    bool isSubsetSum(vector<int>& arr, long long sum) {
+        vector<long long> items(arr.begin(), arr.end());
+        return isSubsetSum(items, sum);
+    }
+};
+
+
+/*
+============================================================================
+10. FRONT-END (PICK THE CHEAPER ENGINE)
+============================================================================
+Estimated word operations:
+    - Bitset DP      : n * (sum / 64 + 1)
+    - Meet in Middle : 2 * 2^(n/2)  (enumerate + join)
+
+Items larger than `sum` can never be taken, so they are dropped first;
+this often shrinks n enough to make meet-in-the-middle viable.
+Bitset DP is only possible while `sum` fits the int-indexed table, and
+meet-in-the-middle only while n <= MAX_MITM_ITEMS (2^22 sums per half,
+~32 MB each). An instance outside both returns false and sets *error
+instead of attempting the allocation, so callers that can receive
+such input must pass `error` to tell "no" from "not solvable here".
+
+TIME COMPLEXITY: min(O(n * sum / 64), O(2^(n/2)))
+============================================================================
+*/
+class SubsetSumSolver {
+public:
+    static const int MAX_MITM_ITEMS = 44;
+
+    bool isSubsetSum(vector<long long>& arr, long long sum, string* error = nullptr) {
+        if(error) error->clear();
+        if(arr.empty() || sum < 0) return false;
+        if(sum == 0) return true;
+
+        vector<long long> items;
+        long long total = 0;
+        for(long long x : arr) {
+            if(x > sum) continue;
+            items.push_back(x);
+            total += x;
+        }
+        if(total < sum) return false;
+        if(total == sum) return true;
+
+        int n = items.size();
+        double dpCost = (double)n * (sum / 64 + 1);
+        double mitmCost = 2.0 * pow(2.0, (n + 1) / 2);
+
+        bool dpFits = sum <= INT_MAX;
+        bool mitmFits = n <= MAX_MITM_ITEMS;
+
+        if(dpFits && (!mitmFits || dpCost <= mitmCost)) {
+            vector<int> small(items.begin(), items.end());
+            return SubsetSumBitset().isSubsetSum(small, (int)sum);
+        }
+        if(mitmFits) return SubsetSumMeetInMiddle().isSubsetSum(items, sum);
+
+        if(error) {
+            *error = "sum " + to_string(sum) + " exceeds the DP table and " +
+                     to_string(n) + " items exceed the meet-in-the-middle limit of " +
+                     to_string(MAX_MITM_ITEMS);
+        }
+        return false;
+    }
+
+    bool isSubsetSum(vector<int>& arr, long long sum, string* error = nullptr) {
+        vector<long long> items(arr.begin(), arr.end());
+        return isSubsetSum(items, sum, error);
+    }
+};
+
+
+/*
+============================================================================
+11. MULTIPLICITY-AWARE (GROUP EQUAL VALUES)
+============================================================================
+With thousands of copies of a few values, treating each copy as its own
+row wastes work: c copies of v can only ever contribute 0, v, 2v, ..., cv.
+Group the items into (value, count) pairs first, then use one of:
+
+A) BINARY SPLITTING
+    Split count c into pieces 1, 2, 4, ..., 2^k, rest. Every amount in
+    [0, c] is a sum of a subset of the pieces, so each piece becomes one
+    0/1 item of value (piece * v) -> one bitset shift-OR each.
+
+    TIME: O(sum / 64 * sum over values of log c)
+
+B) PER-RESIDUE SLIDING WINDOW (BOUNDED KNAPSACK)
+    new[s] = OR of old[s - k*v] for k in [0, c]
+    Within one residue class s mod v this is a window of the last c+1
+    entries. Walking s upward, track how many copies of v the current
+    reachable s already needs:
+
+        used[s] = 0                 if old[s]
+                = used[s - v] + 1   if new[s - v] and used[s - v] < c
+                  (unreachable)     otherwise
+
+    TIME: O(distinct * sum)
+
+SPACE COMPLEXITY: O(sum)
+============================================================================
+*/
+static vector<pair<int, int>> groupByValue(const vector<int>& arr, int sum) {
+    map<int, int> freq;
+    for(int x : arr)
+        if(x > 0 && x <= sum) freq[x]++;     // 0 and oversize items never matter
+    return vector<pair<int, int>>(freq.begin(), freq.end());
+}
+
+class SubsetSumBinarySplitting {
+public:
+    bool isSubsetSum(vector<int>& arr, int sum) {
+        if(arr.empty() || sum < 0) return false;
+
+        ReachableSums dp(sum);
+        for(auto [v, c] : groupByValue(arr, sum)) {
+            for(int piece = 1; c > 0; piece <<= 1) {
+                int take = min(piece, c);
+                long long shift = (long long)take * v;
+                if(shift <= sum) dp.addItem((int)shift);
+                c -= take;
+            }
+            if(dp.test(sum)) return true;
+        }
+
+        return dp.test(sum);
+    }
+};
+
+class SubsetSumBoundedWindow {
+public:
+    bool isSubsetSum(vector<int>& arr, int sum) {
+        if(arr.empty() || sum < 0) return false;
+
+        vector<bool> dp(sum + 1, false);
+        vector<int> used(sum + 1, 0);
+        dp[0] = true;
+
+        for(auto [v, c] : groupByValue(arr, sum)) {
+            for(int s = 0; s <= sum; s++) {
+                if(dp[s]) {
+                    used[s] = 0;
+                } else if(s >= v && dp[s - v] && used[s - v] < c) {
+                    dp[s] = true;
+                    used[s] = used[s - v] + 1;
+                }
+            }
+            if(dp[sum]) return true;
+        }
+
+        return dp[sum];
+    }
+};
+
+
+/*
+============================================================================
+12. SUBSET RECONSTRUCTION (CHECKPOINTED RECOMPUTATION)
+============================================================================
+Let R[i] = bitset of sums reachable with items [0 ... i-1].
+
+Backtracking from (n, sum):
+    R[i][t] already true -> item i is NOT needed, keep t
+    otherwise            -> item i IS taken, t -= arr[i]
+
+That needs every row R[0 ... n], i.e. the full n x sum table. Instead:
+
+    - Forward pass keeps only every B-th row (B = sqrt(n)) as a checkpoint.
+    - Backtrack segment by segment, last to first: rebuild the B rows of
+      the segment from its checkpoint, walk them backwards, drop them.
+
+Every row is computed at most twice (forward + one recompute).
+
+TIME COMPLEXITY: O(2 * n * sum / 64)
+SPACE COMPLEXITY: O(sqrt(n) * sum / 64) words
+============================================================================
+*/
+class SubsetSumReconstruction {
+public:
+    // On success fills `indices` (ascending) with a subset summing to `sum`.
+    bool findSubset(vector<int>& arr, int sum, vector<int>& indices) {
+        indices.clear();
+        int n = arr.size();
+        if(n == 0 || sum < 0) return false;
+
+        int B = max(1, (int)ceil(sqrt((double)n)));
+
+        vector<ReachableSums> checkpoints;
+        ReachableSums row(sum);
+        for(int i = 0; i < n; i++) {
+            if(i % B == 0) checkpoints.push_back(row);
+            row.addItem(arr[i]);
+        }
+        if(!row.test(sum)) return false;
+
+        int t = sum;
+        for(int k = checkpoints.size() - 1; k >= 0 && t > 0; k--) {
+            int lo = k * B, hi = min(n, lo + B);
+
+            // segment[j] = R[lo + j]
+            vector<ReachableSums> segment(1, checkpoints[k]);
+            for(int i = lo; i < hi - 1; i++) {
+                segment.push_back(segment.back());
+                segment.back().addItem(arr[i]);
+            }
+
+            for(int i = hi - 1; i >= lo && t > 0; i--) {
+                if(segment[i - lo].test(t)) continue;
+                indices.push_back(i);
+                t -= arr[i];
+            }
+            checkpoints.pop_back();
+        }
+
+        reverse(indices.begin(), indices.end());
+        return true;
+    }
+};
+
+
+/*
+============================================================================
+13. MULTITHREADED SWEEP (PARTITIONED OVER THE SUM RANGE)
+============================================================================
+For a fixed item, every word of the new row depends only on the OLD row:
+
+    curr[w] = prev[w] | (prev[w - q] << r) | (prev[w - q - 1] >> (64 - r))
+
+With two buffers (prev / curr) the word range can be split across
+threads with no ordering at all -- nobody ever reads a word that another
+thread is writing. After each item:
+
+    - all threads meet at a barrier
+    - every thread swaps its own prev/curr pointers (same order everywhere)
+
+Each thread owns one contiguous range of words, so its writes stay in
+its own cache lines (no false sharing except at the range ends). Ranges
+are at least MIN_WORDS_PER_THREAD long; small sums run on one thread.
+
+TIME COMPLEXITY: O(n * sum / (64 * T)) + O(n) barriers
+SPACE COMPLEXITY: O(2 * sum / 64) words
+============================================================================
+*/
+class SpinBarrier {
+private:
+    const int parties;
+    atomic<int> waiting{0};
+    atomic<int> generation{0};
+
+public:
+    explicit SpinBarrier(int parties) : parties(parties) {}
+
+    void arriveAndWait() {
+        int gen = generation.load(memory_order_acquire);
+        if(waiting.fetch_add(1, memory_order_acq_rel) == parties - 1) {
+            waiting.store(0, memory_order_relaxed);
+            generation.fetch_add(1, memory_order_release);
+            return;
+        }
+        while(generation.load(memory_order_acquire) == gen)
+            this_thread::yield();
+    }
+};
+
+class SubsetSumParallel {
+private:
+    static const int MIN_WORDS_PER_THREAD = 1 << 12;    // 32 KB
+
+    // dst[lo, hi) = src | (src << shift)
+    static void shiftOrRange(const uint64_t* src, uint64_t* dst,
+                             int lo, int hi, int shift) {
+        int q = shift >> 6, r = shift & 63;
+        for(int i = lo; i < hi; i++) {
+            uint64_t v = src[i];
+            if(i >= q) {
+                v |= src[i - q] << r;
+                if(r && i > q) v |= src[i - q - 1] >> (64 - r);
+            }
+            dst[i] = v;
+        }
+    }
+
+    int threads;
+
+public:
+    explicit SubsetSumParallel(int threads = 0)
+        : threads(threads > 0 ? threads : max(1u, thread::hardware_concurrency())) {}
+
+    bool isSubsetSum(vector<int>& arr, int sum) {
+        if(arr.empty() || sum < 0) return false;
+
+        int nw = sum / 64 + 1;
+        int T = max(1, min(threads, nw / MIN_WORDS_PER_THREAD));
+
+        vector<uint64_t> bufA(nw, 0), bufB(nw, 0);
+        bufA[0] = 1;
+
+        SpinBarrier barrier(T);
+        auto test = [&](const uint64_t* row) {
+            return (row[sum >> 6] >> (sum & 63)) & 1;
+        };
+
+        auto worker = [&](int id) {
+            int lo = (long long)nw * id / T;
+            int hi = (long long)nw * (id + 1) / T;
+            uint64_t* prev = bufA.data();
+            uint64_t* curr = bufB.data();
+
+            for(int x : arr) {
+                if(x <= 0 || x > sum) continue;
+                shiftOrRange(prev, curr, lo, hi, x);
+                barrier.arriveAndWait();
+                swap(prev, curr);
+                if(test(prev)) break;       // same decision on every thread
+            }
+        };
+
+        vector<thread> pool;
+        for(int id = 1; id < T; id++) pool.emplace_back(worker, id);
+        worker(0);
+        for(auto& th : pool) th.join();
+
+        return test(bufA.data()) || test(bufB.data());
+    }
+};
+
+
+/*
+============================================================================
+14. SEMIRING DP (DECISION / COUNTING / MOD COUNTING / MIN CARDINALITY)
+============================================================================
+The take / notTake recurrence never cares WHAT is stored in dp[s]:
+
+    dp[ind][s] = notTake  (+)  extend(take)
+
+Only the two operations change with the question being asked:
+
+    Semiring        value       (+)          extend(v)    dp[0] / others
+    -----------------------------------------------------------------------
+    Bool            reachable   OR           v            1 / 0
+    Count<T>        #subsets    +            v            1 / 0
+    ModCount<P>     #subsets%P  + mod P      v            1 / 0
+    MinCard         min items   min          v + 1        0 / INF
+
+So one templated DP answers every question type.
+
+VECTORIZED ITEM KERNEL:
+    In the 1D in-place loop, writes to dp[s] read dp[s - x]. Walking
+    from the top in chunks of length x, each chunk [s - x + 1, s] reads
+    [s - 2x + 1, s - x], which does NOT overlap it. So every chunk is a
+    plain dst[j] = dst[j] (+) extend(src[j]) loop over disjoint
+    pointers, and every (+) / extend above is branch-free.
+
+    SemiringKernel<S> supplies that chunk loop as explicit AVX2, picked
+    ONCE at runtime through CPUID like the shift-OR kernels:
+        Bool        32 bytes OR per step
+        Count<u64>  4 x 64-bit add
+        ModCount<P> 4 x (add, compare with P - 1, subtract P where above)
+        MinCard     8 x (add 1 unless INT_MAX, min)
+    Count<__int128> has no vector form and stays on the scalar loop,
+    which is also every kernel's fallback and tail.
+
+TIME COMPLEXITY: O(n * sum)
+SPACE COMPLEXITY:
+    - tabulate : O(n * sum)
+    - solve    : O(sum)
+============================================================================
+*/
+struct BoolSemiring {
+    typedef uint8_t T;
+    static T zero() { return 0; }
+    static T one() { return 1; }
+    static T plus(T a, T b) { return a | b; }
+    static T extend(T a) { return a; }
+};
+
+template<class U>                   // uint64_t or __int128 for exact counts
+struct CountSemiring {
+    typedef U T;
+    static T zero() { return 0; }
+    static T one() { return 1; }
+    static T plus(T a, T b) { return a + b; }
+    static T extend(T a) { return a; }
+};
+
+template<uint64_t P>
+struct ModCountSemiring {
+    typedef uint64_t T;
+    static T zero() { return 0; }
+    static T one() { return 1; }
+    static T plus(T a, T b) { T v = a + b; return v - (v >= P ? P : 0); }
+    static T extend(T a) { return a; }
+};
+
+struct MinCardSemiring {
+    typedef int T;
+    static T zero() { return INT_MAX; }             // unreachable
+    static T one() { return 0; }                    // empty subset
+    static T plus(T a, T b) { return min(a, b); }
+    static T extend(T a) { return a + (a != INT_MAX); }
+};
+
+// dst[j] = dst[j] (+) extend(src[j]), dst and src disjoint
+template<class S>
+static void combineScalar(typename S::T* __restrict dst,
+                          const typename S::T* __restrict src, int len) {
+    for(int j = 0; j < len; j++)
+        dst[j] = S::plus(dst[j], S::extend(src[j]));
+}
+
+// Default: no vector kernel for this semiring.
+template<class S>
+struct SemiringKernel {
+    typedef void (*Fn)(typename S::T* dst, const typename S::T* src, int len);
+    static Fn pick() { return combineScalar<S>; }
+};
+
+#ifdef SUBSET_SUM_X86
+__attribute__((target("avx2")))
+static void combineBoolAVX2(uint8_t* dst, const uint8_t* src, int len) {
+    int j = 0;
+    for(; j + 32 <= len; j += 32) {
+        __m256i a = _mm256_loadu_si256((const __m256i*)(dst + j));
+        __m256i b = _mm256_loadu_si256((const __m256i*)(src + j));
+        _mm256_storeu_si256((__m256i*)(dst + j), _mm256_or_si256(a, b));
+    }
+    combineScalar<BoolSemiring>(dst + j, src + j, len - j);
+}
+
+__attribute__((target("avx2")))
+static void combineCountAVX2(uint64_t* dst, const uint64_t* src, int len) {
+    int j = 0;
+    for(; j + 4 <= len; j += 4) {
+        __m256i a = _mm256_loadu_si256((const __m256i*)(dst + j));
+        __m256i b = _mm256_loadu_si256((const __m256i*)(src + j));
+        _mm256_storeu_si256((__m256i*)(dst + j), _mm256_add_epi64(a, b));
+    }
+    combineScalar<CountSemiring<uint64_t>>(dst + j, src + j, len - j);
+}
+
+// Needs P < 2^62: a + b < 2^63, so the signed compare is exact.
+template<uint64_t P>
+__attribute__((target("avx2")))
+static void combineModCountAVX2(uint64_t* dst, const uint64_t* src, int len) {
+    const __m256i mod = _mm256_set1_epi64x(P);
+    const __m256i top = _mm256_set1_epi64x(P - 1);
+
+    int j = 0;
+    for(; j + 4 <= len; j += 4) {
+        __m256i a = _mm256_loadu_si256((const __m256i*)(dst + j));
+        __m256i b = _mm256_loadu_si256((const __m256i*)(src + j));
+        __m256i v = _mm256_add_epi64(a, b);
+        __m256i over = _mm256_cmpgt_epi64(v, top);
+        _mm256_storeu_si256((__m256i*)(dst + j),
+                            _mm256_sub_epi64(v, _mm256_and_si256(over, mod)));
+    }
+    combineScalar<ModCountSemiring<P>>(dst + j, src + j, len - j);
+}
+
+__attribute__((target("avx2")))
+static void combineMinCardAVX2(int* dst, const int* src, int len) {
+    const __m256i inf = _mm256_set1_epi32(INT_MAX);
+    const __m256i one = _mm256_set1_epi32(1);
+
+    int j = 0;
+    for(; j + 8 <= len; j += 8) {
+        __m256i a = _mm256_loadu_si256((const __m256i*)(dst + j));
+        __m256i b = _mm256_loadu_si256((const __m256i*)(src + j));
+        __m256i unreachable = _mm256_cmpeq_epi32(b, inf);
+        __m256i ext = _mm256_add_epi32(b, _mm256_andnot_si256(unreachable, one));
+        _mm256_storeu_si256((__m256i*)(dst + j), _mm256_min_epi32(a, ext));
+    }
+    combineScalar<MinCardSemiring>(dst + j, src + j, len - j);
+}
+
+static bool semiringHasAVX2() {
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("avx2");
+}
+#endif
+
+template<>
+struct SemiringKernel<BoolSemiring> {
+    typedef void (*Fn)(uint8_t* dst, const uint8_t* src, int len);
+    static Fn pick() {
+#ifdef SUBSET_SUM_X86
+        if(semiringHasAVX2()) return combineBoolAVX2;
+#endif
+        return combineScalar<BoolSemiring>;
+    }
+};
+
+template<>
+struct SemiringKernel<CountSemiring<uint64_t>> {
+    typedef void (*Fn)(uint64_t* dst, const uint64_t* src, int len);
+    static Fn pick() {
+#ifdef SUBSET_SUM_X86
+        if(semiringHasAVX2()) return combineCountAVX2;
+#endif
+        return combineScalar<CountSemiring<uint64_t>>;
+    }
+};
+
+template<uint64_t P>
+struct SemiringKernel<ModCountSemiring<P>> {
+    typedef void (*Fn)(uint64_t* dst, const uint64_t* src, int len);
+    static Fn pick() {
+#ifdef SUBSET_SUM_X86
+        if(P < (1ULL << 62) && semiringHasAVX2()) return combineModCountAVX2<P>;
+#endif
+        return combineScalar<ModCountSemiring<P>>;
+    }
+};
+
+template<>
+struct SemiringKernel<MinCardSemiring> {
+    typedef void (*Fn)(int* dst, const int* src, int len);
+    static Fn pick() {
+#ifdef SUBSET_SUM_X86
+        if(semiringHasAVX2()) return combineMinCardAVX2;
+#endif
+        return combineScalar<MinCardSemiring>;
+    }
+};
+
+template<class S>
+class SubsetSumSemiring {
+private:
+    typedef typename S::T T;
+
+    // dst[j] = dst[j] (+) extend(src[j]), dst and src disjoint
+    static void combine(T* dst, const T* src, int len) {
+        static const typename SemiringKernel<S>::Fn kernel = SemiringKernel<S>::pick();
+        kernel(dst, src, len);
+    }
+
+    // dst[s] = src[s] (+) extend(src[s - x]), separate rows
+    static void applyItem(const T* src, T* dst, int sum, int x) {
+        for(int s = 0; s <= sum; s++) dst[s] = src[s];
+        if(x <= sum) combine(dst + x, src, sum - x + 1);
+    }
+
+    // dp[s] = dp[s] (+) extend(dp[s - x]), in place, chunks of x from the top
+    static void applyItem(T* dp, int sum, int x) {
+        if(x > sum) return;
+        if(x == 0) {
+            for(int s = 0; s <= sum; s++) dp[s] = S::plus(dp[s], S::extend(dp[s]));
+            return;
+        }
+        for(int hi = sum + 1; hi > x; hi -= x) {
+            int lo = max(x, hi - x);
+            combine(dp + lo, dp + lo - x, hi - lo);
+        }
+    }
+
+public:
+    // table[ind][s] over items [0 ... ind], same shape as SubsetSumTabulation
+    vector<vector<T>> tabulate(vector<int>& arr, int sum) {
+        int n = arr.size();
+        vector<vector<T>> table;
+        if(n == 0 || sum < 0) return table;
+
+        vector<T> base(sum + 1, S::zero());
+        base[0] = S::one();
+
+        table.assign(n, vector<T>(sum + 1));
+        applyItem(base.data(), table[0].data(), sum, arr[0]);
+        for(int ind = 1; ind < n; ind++)
+            applyItem(table[ind - 1].data(), table[ind].data(), sum, arr[ind]);
+
+        return table;
+    }
+
+    T solve(vector<int>& arr, int sum) {
+        if(sum < 0) return S::zero();
+
+        vector<T> dp(sum + 1, S::zero());
+        dp[0] = S::one();
+        for(int x : arr)
+            if(x >= 0) applyItem(dp.data(), sum, x);
+
+        return dp[sum];
+    }
+};
+
+typedef SubsetSumSemiring<BoolSemiring>                   SubsetSumDecision;
+typedef SubsetSumSemiring<CountSemiring<uint64_t>>        SubsetSumCount;
+typedef SubsetSumSemiring<CountSemiring<__int128>>        SubsetSumCountWide;
+typedef SubsetSumSemiring<ModCountSemiring<1000000007>>   SubsetSumCountMod;
+typedef SubsetSumSemiring<MinCardSemiring>                SubsetSumMinCardinality;
+
+
 /*
 ============================================================================
 MAIN FUNCTION
@@ -269,7 +1376,7 @@ int main() {
     vector<int> arr = {1, 2, 3, 4};
     int sum = 6;
 
-    SubsetSumSpaceOptimized1D solver;
+    SubsetSumSolver solver;
     cout << solver.isSubsetSum(arr, sum) << endl;
 
     return 0;
@@ -0,0 +1,261 @@
+/*
+============================================================================
+UTILITY: Binary Grid Format + Zero-Copy mmap Loader
+PATTERN: Memory-mapped input
+============================================================================
+
+WHY
+----------------------------------------------------------------------------
+Parsing a multi-gigabyte grid as text through `cin >>` costs more than
+solving it. In this format the element data is already the in-memory
+int32 array, so loading is a single mmap: no parsing, no copying, and
+no per-row heap allocation. The OS pages rows in as the solver touches
+them.
+
+----------------------------------------------------------------------------
+
+FILE LAYOUT (little-endian)
+----------------------------------------------------------------------------
+    offset 0   BinaryGridHeader (48 bytes)
+                 magic       "DPGR"
+                 version     1
+                 elemType    1 = int32
+                 flags       bit 0 = TRIANGLE (row i has i + 1 entries)
+                 rows
+                 cols        row length (rectangles), 0 for triangles
+                 dataOffset  byte offset of element data, 64-byte aligned
+    offset 48  TRIANGLE only: uint64 rowOffset[rows + 1]
+                 element index where row i starts; last entry = total
+    dataOffset int32 elements, row after row, no padding
+
+----------------------------------------------------------------------------
+
+PIECES
+----------------------------------------------------------------------------
+GridView       strided read-only view: rows(), rowLength(i), row(i),
+               (i, j). Rectangles use a fixed stride, triangles the
+               row-offset table. Never owns memory.
+MappedGrid     opens + validates a file, owns the mapping, hands out
+               a GridView into it.
+writeBinaryGrid  converts an in-memory grid (or triangle) to the format.
+checkRectangle / checkTriangle
+               driver-side checks that a loaded grid has the shape a
+               solver expects (non-empty, rectangle vs triangle, width).
+
+Errors are reported as `false` plus a message, never by aborting.
+============================================================================
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+static_assert(sizeof(int) == 4, "binary grid elements are int32");
+
+struct BinaryGridHeader {
+    char     magic[4];
+    uint32_t version;
+    uint32_t elemType;
+    uint32_t flags;
+    uint64_t rows;
+    uint64_t cols;
+    uint64_t dataOffset;
+    uint64_t reserved;
+
+    static const uint32_t VERSION = 1;
+    static const uint32_t ELEM_INT32 = 1;
+    static const uint32_t FLAG_TRIANGLE = 1;
+};
+
+static_assert(sizeof(BinaryGridHeader) == 48, "header layout is part of the format");
+
+class GridView {
+private:
+    const int* data = nullptr;
+    const uint64_t* rowOffset = nullptr;    // nullptr -> rectangle
+    size_t nRows = 0, nCols = 0;
+
+public:
+    GridView() {}
+    GridView(const int* data, size_t rows, size_t cols)
+        : data(data), nRows(rows), nCols(cols) {}
+    GridView(const int* data, const uint64_t* rowOffset, size_t rows)
+        : data(data), rowOffset(rowOffset), nRows(rows) {}
+
+    size_t rows() const { return nRows; }
+    bool isTriangle() const { return rowOffset != nullptr; }
+
+    size_t rowLength(size_t i) const {
+        return rowOffset ? rowOffset[i + 1] - rowOffset[i] : nCols;
+    }
+
+    const int* row(size_t i) const {
+        return data + (rowOffset ? rowOffset[i] : i * nCols);
+    }
+
+    int operator()(size_t i, size_t j) const { return row(i)[j]; }
+};
+
+class MappedGrid {
+private:
+    void* base = MAP_FAILED;
+    size_t length = 0;
+    GridView gridView;
+
+    bool fail(std::string* error, const std::string& msg) {
+        close();
+        if(error) *error = msg;
+        return false;
+    }
+
+public:
+    MappedGrid() {}
+    ~MappedGrid() { close(); }
+
+    MappedGrid(const MappedGrid&) = delete;
+    MappedGrid& operator=(const MappedGrid&) = delete;
+
+    bool open(const std::string& path, std::string* error = nullptr) {
+        close();
+
+        int fd = ::open(path.c_str(), O_RDONLY);
+        if(fd < 0) return fail(error, "cannot open " + path);
+
+        struct stat st;
+        if(fstat(fd, &st) != 0 || st.st_size < (off_t)sizeof(BinaryGridHeader)) {
+            ::close(fd);
+            return fail(error, "file too small for a grid header");
+        }
+
+        length = st.st_size;
+        base = mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0);
+        ::close(fd);
+        if(base == MAP_FAILED) return fail(error, "mmap failed");
+        madvise(base, length, MADV_SEQUENTIAL);
+
+        const char* bytes = (const char*)base;
+        BinaryGridHeader h;
+        memcpy(&h, bytes, sizeof h);
+
+        if(memcmp(h.magic, "DPGR", 4) != 0) return fail(error, "bad magic");
+        if(h.version != BinaryGridHeader::VERSION) return fail(error, "unsupported version");
+        if(h.elemType != BinaryGridHeader::ELEM_INT32) return fail(error, "unsupported element type");
+        if(h.dataOffset % 64 != 0 || h.dataOffset > length)
+            return fail(error, "bad data offset");
+
+        const int* data = (const int*)(bytes + h.dataOffset);
+        uint64_t available = (length - h.dataOffset) / sizeof(int);
+
+        if(h.flags & BinaryGridHeader::FLAG_TRIANGLE) {
+            uint64_t tableEnd = sizeof h + (h.rows + 1) * sizeof(uint64_t);
+            if(h.rows > length || tableEnd > h.dataOffset)
+                return fail(error, "truncated row-offset table");
+
+            // row i must hold exactly i + 1 entries
+            const uint64_t* offsets = (const uint64_t*)(bytes + sizeof h);
+            if(offsets[0] != 0) return fail(error, "row offsets must start at 0");
+            for(uint64_t i = 0; i < h.rows; i++)
+                if(offsets[i + 1] - offsets[i] != i + 1)
+                    return fail(error, "triangle row " + std::to_string(i) + " does not have "
+                                       + std::to_string(i + 1) + " entries");
+            if(offsets[h.rows] > available) return fail(error, "truncated element data");
+
+            gridView = GridView(data, offsets, h.rows);
+        } else {
+            if(h.cols != 0 && h.rows > available / h.cols)
+                return fail(error, "truncated element data");
+            gridView = GridView(data, h.rows, h.cols);
+        }
+        return true;
+    }
+
+    void close() {
+        if(base != MAP_FAILED) munmap(base, length);
+        base = MAP_FAILED;
+        length = 0;
+        gridView = GridView();
+    }
+
+    const GridView& view() const { return gridView; }
+};
+
+// cols == 0 accepts any positive width; square also requires rows == cols.
+inline bool checkRectangle(const GridView& grid, size_t cols, bool square,
+                           std::string* error = nullptr) {
+    std::string msg;
+    if(grid.isTriangle()) msg = "expected a rectangular grid, got a triangle";
+    else if(grid.rows() == 0 || grid.rowLength(0) == 0) msg = "grid is empty";
+    else if(cols != 0 && grid.rowLength(0) != cols)
+        msg = "expected " + std::to_string(cols) + " columns, got " + std::to_string(grid.rowLength(0));
+    else if(square && grid.rows() != grid.rowLength(0)) msg = "expected a square grid";
+    else return true;
+
+    if(error) *error = msg;
+    return false;
+}
+
+inline bool checkTriangle(const GridView& grid, std::string* error = nullptr) {
+    std::string msg;
+    if(!grid.isTriangle()) msg = "expected a triangle, got a rectangular grid";
+    else if(grid.rows() == 0) msg = "triangle is empty";
+    else return true;
+
+    if(error) *error = msg;
+    return false;
+}
+
+inline bool writeBinaryGrid(const std::string& path,
+                            const std::vector<std::vector<int>>& grid,
+                            bool triangle, std::string* error = nullptr) {
+    BinaryGridHeader h;
+    memset(&h, 0, sizeof h);
+    memcpy(h.magic, "DPGR", 4);
+    h.version = BinaryGridHeader::VERSION;
+    h.elemType = BinaryGridHeader::ELEM_INT32;
+    h.flags = triangle ? BinaryGridHeader::FLAG_TRIANGLE : 0;
+    h.rows = grid.size();
+    h.cols = (triangle || grid.empty()) ? 0 : grid[0].size();
+
+    std::vector<uint64_t> offsets;
+    if(triangle) {
+        offsets.push_back(0);
+        for(const auto& r : grid) offsets.push_back(offsets.back() + r.size());
+    } else {
+        for(const auto& r : grid) {
+            if(r.size() != h.cols) {
+                if(error) *error = "rows differ in length";
+                return false;
+            }
+        }
+    }
+
+    uint64_t headerBytes = sizeof h + offsets.size() * sizeof(uint64_t);
+    h.dataOffset = (headerBytes + 63) / 64 * 64;
+
+    FILE* f = fopen(path.c_str(), "wb");
+    if(!f) {
+        if(error) *error = "cannot create " + path;
+        return false;
+    }
+
+    static const char zeros[64] = {};
+    bool ok = fwrite(&h, sizeof h, 1, f) == 1;
+    if(ok && !offsets.empty())
+        ok = fwrite(offsets.data(), sizeof(uint64_t), offsets.size(), f) == offsets.size();
+    if(ok) ok = fwrite(zeros, 1, h.dataOffset - headerBytes, f) == h.dataOffset - headerBytes;
+    for(size_t i = 0; ok && i < grid.size(); i++)
+        ok = fwrite(grid[i].data(), sizeof(int), grid[i].size(), f) == grid[i].size();
+
+    ok = (fclose(f) == 0) && ok;
+    if(!ok && error) *error = "write failed";
+    return ok;
+}
@@ -0,0 +1,128 @@
+/*
+============================================================================
+UTILITY: Row-at-a-Time Grid Input
+PATTERN: Streaming producer / consumer
+============================================================================
+
+WHY
+----------------------------------------------------------------------------
+The space-optimized grid DPs only ever look at the current row (plus
+their own O(m) or O(m^2) state), yet the drivers read the whole n x m
+grid into memory first. Feeding rows one at a time keeps the resident
+input at O(m), so grids larger than RAM go through in one pass.
+
+----------------------------------------------------------------------------
+
+PIECES
+----------------------------------------------------------------------------
+RowReader
+    bool next(std::vector<int>& row)
+    Fills `row` with the next grid row, returns false when the grid is
+    exhausted. Any callable with this signature works (file parser,
+    generator, network feed, ...).
+
+istreamRows(in, rows, cols)
+    RowReader over whitespace-separated ints.
+
+PrefetchedRows
+    Wraps a RowReader and runs it on a background thread that keeps up
+    to `depth` parsed rows ready, so parsing row i+1 overlaps with the
+    DP step on row i. Rows are handed over by swap, no copies.
+
+----------------------------------------------------------------------------
+
+COMPLEXITY
+----------------------------------------------------------------------------
+Space : O(depth * m) for the prefetch ring
+============================================================================
+*/
+
+#pragma once
+
+#include <condition_variable>
+#include <functional>
+#include <istream>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+typedef std::function<bool(std::vector<int>&)> RowReader;
+
+inline RowReader istreamRows(std::istream& in, int rows, int cols) {
+    auto left = std::make_shared<int>(rows);
+    return [&in, left, cols](std::vector<int>& row) {
+        if(*left <= 0) return false;
+        (*left)--;
+
+        row.resize(cols);
+        for(int j = 0; j < cols; j++) in >> row[j];
+        return true;
+    };
+}
+
+class PrefetchedRows {
+private:
+    RowReader source;
+    std::vector<std::vector<int>> ring;
+    size_t head = 0, count = 0;             // ring[head] is the oldest row
+    bool finished = false, stopping = false;
+
+    std::mutex mtx;
+    std::condition_variable notEmpty, notFull;
+    std::thread producer;
+
+    void produce() {
+        std::vector<int> row;
+        while(true) {
+            bool ok = source(row);
+
+            std::unique_lock<std::mutex> lock(mtx);
+            if(!ok) {
+                finished = true;
+                notEmpty.notify_one();
+                return;
+            }
+            notFull.wait(lock, [&] { return stopping || count < ring.size(); });
+            if(stopping) return;
+
+            ring[(head + count) % ring.size()].swap(row);
+            count++;
+            notEmpty.notify_one();
+        }
+    }
+
+public:
+    explicit PrefetchedRows(RowReader source, int depth = 4)
+        : source(std::move(source)), ring(depth > 0 ? depth : 1) {
+        producer = std::thread(&PrefetchedRows::produce, this);
+    }
+
+    ~PrefetchedRows() {
+        {
+            std::lock_guard<std::mutex> lock(mtx);
+            stopping = true;
+        }
+        notFull.notify_one();
+        producer.join();
+    }
+
+    PrefetchedRows(const PrefetchedRows&) = delete;
+    PrefetchedRows& operator=(const PrefetchedRows&) = delete;
+
+    bool next(std::vector<int>& row) {
+        std::unique_lock<std::mutex> lock(mtx);
+        notEmpty.wait(lock, [&] { return count > 0 || finished; });
+        if(count == 0) return false;
+
+        row.swap(ring[head]);
+        head = (head + 1) % ring.size();
+        count--;
+        notFull.notify_one();
+        return true;
+    }
+
+    RowReader reader() {
+        return [this](std::vector<int>& row) { return next(row); };
+    }
+};
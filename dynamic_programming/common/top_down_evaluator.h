@@ -0,0 +1,139 @@
+/*
+============================================================================
+UTILITY: Stack-Safe Top-Down Evaluator
+PATTERN: Memoization without native recursion
+============================================================================
+
+WHY
+----------------------------------------------------------------------------
+A memoized recursion f(state) -> f(dep1), f(dep2), ... recurses to the
+depth of the longest dependency chain (n for most DP problems). At
+n = 1e6 that overflows the call stack.
+
+This evaluator drives the SAME recurrence with an explicit stack on the
+heap, and it keeps the lazy top-down property: only states reachable
+from the root are ever visited.
+
+----------------------------------------------------------------------------
+
+HOW
+----------------------------------------------------------------------------
+Each stack frame is a state plus an "expanded" flag.
+
+    1. First visit  : push every dependency that is not solved yet,
+                      mark the frame expanded.
+    2. Second visit : all dependencies are solved now ->
+                      combine their values, memoize, pop.
+
+Base cases are answered directly and never stored, and the memo is a
+hash map, so memory grows with the states actually visited instead of a
+dense n x m table.
+
+----------------------------------------------------------------------------
+
+PROBLEM INTERFACE
+----------------------------------------------------------------------------
+struct Problem {
+    typedef ... State;              // hashable, equality comparable
+    typedef ... Value;
+    typedef ... Hash;               // hash functor for State
+
+    bool isBase(const State& s, Value& out);
+    void dependencies(const State& s, std::vector<State>& out);
+    Value combine(const State& s, const std::vector<Value>& depValues);
+};
+
+`dependencies` must return the same list on every call for a given
+state (it is called once to expand and once to combine), and the
+dependency graph must be acyclic.
+
+----------------------------------------------------------------------------
+
+COMPLEXITY
+----------------------------------------------------------------------------
+Time  : O(visited states * dependencies per state)
+Space : O(visited states)  (memo + explicit stack)
+============================================================================
+*/
+
+#pragma once
+
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+template<class Problem>
+class TopDownEvaluator {
+private:
+    typedef typename Problem::State State;
+    typedef typename Problem::Value Value;
+    typedef typename Problem::Hash  Hash;
+
+    struct Frame {
+        State state;
+        bool expanded;
+    };
+
+    Problem& problem;
+    std::unordered_map<State, Value, Hash> memo;
+
+    // Solved = base case or already memoized.
+    bool lookup(const State& s, Value& out) {
+        if(problem.isBase(s, out)) return true;
+
+        auto it = memo.find(s);
+        if(it == memo.end()) return false;
+        out = it->second;
+        return true;
+    }
+
+public:
+    explicit TopDownEvaluator(Problem& problem) : problem(problem) {}
+
+    Value evaluate(const State& root) {
+        Value result{};
+        if(lookup(root, result)) return result;
+
+        std::vector<Frame> stack;
+        std::vector<State> deps;
+        std::vector<Value> values;
+
+        stack.push_back({root, false});
+
+        while(!stack.empty()) {
+            Frame& top = stack.back();
+            State s = top.state;
+
+            Value v{};
+            if(lookup(s, v)) {                  // solved via another path
+                stack.pop_back();
+                continue;
+            }
+
+            deps.clear();
+            problem.dependencies(s, deps);
+
+            if(!top.expanded) {
+                top.expanded = true;            // `top` is invalid after push
+                for(const State& d : deps)
+                    if(!lookup(d, v)) stack.push_back({d, false});
+                continue;
+            }
+
+            values.clear();
+            for(const State& d : deps) {
+                lookup(d, v);
+                values.push_back(v);
+            }
+            memo.emplace(s, problem.combine(s, values));
+            stack.pop_back();
+        }
+
+        lookup(root, result);
+        return result;
+    }
+
+    size_t visitedStates() const { return memo.size(); }
+
+    void reset() { memo.clear(); }
+};